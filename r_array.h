@@ -11,17 +11,56 @@
 // RA_SILENT - This will silence any non-crashing messages. Some messages will
 //             still print on crash regardless; maybe this can be changed.
 //
+// RA_NO_ZERO - By default, `aa_create()` zeroes its memory (lazily, through
+//              `calloc()`). Defining this makes it use `aa_create_unzeroed()`
+//              instead. r_array never reads past `count`, so this is safe for
+//              arrays; only raw arena users might care.
+//
+// RA_DEFAULT_STRING_CHUNK - Size, in bytes, of the chunks string pools
+//                           allocate (2048 by default). See `ra_strpool`.
+//
+// RA_DEFAULT_GROWTH_FACTOR - The growth factor `ra_create_growable()` is
+//                            meant to be called with (2.0 by default). Arrays
+//                            made with `ra_create()` keep a fixed capacity,
+//                            for the no-`malloc()`-after-startup crowd.
+//
+// RA_NO_SIMD - The search kernels (`ra_find_ints()` etc., which `ra_member_at()`
+//              uses for int, double and the raylib vector types) use AVX2 or
+//              SSE2 when the compiler targets them. Defining this forces the
+//              plain C versions.
+//
 // RA_STATIC_INIT(type_pair) - This is useful for initializing an array before
 //                             allocating its memory i.e. for creating globals
 //                             or whatever. Necessary because ra_type is const
 //                             so it cannot be modified or zeroed.
+//
+// TYPED API
+// Every type (including the generated ones) also gets a strongly-typed API,
+// e.g. `r_array_Vector2`, `ra_append_Vector2()`, `ra_get_Vector2()`. These do
+// no type lookup at runtime, so they should be preferred in hot loops. The
+// generic `r_array` is available through the `.ra` field of a typed array.
 //------------------------------------------------------------------------------
 
+#pragma once
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdarg.h>
 #include <stdbool.h>
+#include <stddef.h>
+
+#if !defined(RA_NO_SIMD) && defined(__AVX2__)
+    #define RA_SIMD_AVX2
+    #include <immintrin.h>
+#elif !defined(RA_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    #define RA_SIMD_SSE2
+    #include <emmintrin.h>
+#endif
+
+#ifdef _MSC_VER
+    #include <intrin.h>
+#endif
 //gen 1 "Include headers for types."
 #include <raymath.h> // for Vector3
 #include "wectangle3.h" // for Wectangle
@@ -50,9 +89,11 @@ ra_type RA_INT = DEFINE_RA_TYPE(int);
 ra_type RA_STR = DEFINE_RA_PNT_TYPE(char *);
 //gen 2 "Define types."
 ra_type RA_FLOAT = DEFINE_RA_TYPE(double); // from stdlib
+ra_type RA_F32 = DEFINE_RA_TYPE(float); // from stdlib
 ra_type RA_VECTOR3 = DEFINE_RA_TYPE(Vector3); // from <raymath.h>
-ra_type RA_VECTOR2 = DEFINE_RA_TYPE(Vector2); // from stdlib
+ra_type RA_VECTOR2 = DEFINE_RA_TYPE(Vector2); // from <raymath.h>
 ra_type RA_WECTANGLE = DEFINE_RA_TYPE(Wectangle); // from wectangle3.h
+ra_type RA_WECPAIR = DEFINE_RA_TYPE(WecPair); // from wectangle3.h
 
 //----------------------------
 // arena definitions
@@ -63,24 +104,59 @@ ra_type RA_WECTANGLE = DEFINE_RA_TYPE(Wectangle); // from wectangle3.h
  * @param root `void *`, allocated pointer to a block of memory of size `capacity`.
  * @param position `void *`, the end of allocated space in that memory.
  * @param capacity `size_t`, the size, in bytes, of the memory block.
+ * @param growth `float`, factor the capacity is multiplied by when an allocation doesn't fit. If this is `<= 1.0f` (the default), the arena is fixed-capacity and overflows like it always has.
+ * @param pool `struct _aa_pool *`, the pool `root` is a slot of (see `aa_create_pooled()`), or `NULL` if it came from `malloc()`.
  */
 typedef struct {
     void * root;
     void * position;
     size_t capacity;
+    float growth;
+    struct _aa_pool * pool;
 } aa_arena;
 
-aa_arena ________________internal_ra_space_for_pointers;
-bool internal_ra_space_for_pointers_has_been_initialized = false;
 
 /**
- * Create an arena.
+ * Create an arena. The memory is zeroed with `calloc()`, so large arenas get fresh pages from the OS which are zeroed lazily on first touch instead of all up front. Unless `RA_NO_ZERO` is defined; see `aa_create_unzeroed()`.
  * 
  * @param capacity The number of bytes to allocate.
  * @return An arena with an allocation of the requested size.
  */
 aa_arena aa_create(size_t capacity);
 
+/**
+ * Create an arena without zeroing its memory. Cheapest option when everything will be written before it is read.
+ * 
+ * @param capacity The number of bytes to allocate.
+ * @return An arena with an allocation of the requested size, with unspecified contents.
+ */
+aa_arena aa_create_unzeroed(size_t capacity);
+
+/**
+ * Create an arena which grows (with `realloc()`) instead of overflowing. Growing moves the memory, so pointers into the arena are invalidated by any allocation that grows it.
+ * 
+ * @param capacity The number of bytes to allocate up front.
+ * @param growth The factor to multiply the capacity by when it runs out. Must be greater than `1.0f`.
+ * @return An arena with an allocation of the requested size.
+ */
+aa_arena aa_create_growable(size_t capacity, float growth);
+
+/**
+ * Make sure an arena has at least `capacity` bytes. This works on fixed-capacity arenas too; it is the only way their capacity changes.
+ * 
+ * @param arena The arena to grow.
+ * @param capacity The minimum capacity, in bytes.
+ * @return `false` if the reallocation failed (the arena is left untouched), `true` otherwise.
+ */
+bool aa_reserve(aa_arena * arena, size_t capacity);
+
+/**
+ * Shrink an arena's allocation down to the bytes actually in use. Empty arenas are left alone.
+ * 
+ * @param arena The arena to shrink.
+ */
+void aa_shrink_to_fit(aa_arena * arena);
+
 /**
  * Free the memory assigned to an arena.
  * 
@@ -89,7 +165,16 @@ aa_arena aa_create(size_t capacity);
 void aa_destroy(aa_arena arena);
 
 /**
- * Allocate memory within an arena. If `RA_NO_CRASH_ON_OVERFLOW` is defined, then this will return `NULL` (and print an error message) when the arena runs out of space. Otherwise, this crash the program.
+ * Make room for `size` more bytes in a growable arena, growing it geometrically if needed. Does nothing to fixed-capacity arenas.
+ * 
+ * @param arena The arena to grow.
+ * @param size The number of bytes about to be allocated.
+ * @return Whether `size` bytes now fit.
+ */
+bool aa_grow_for(aa_arena * arena, size_t size);
+
+/**
+ * Allocate memory within an arena. Growable arenas (see `aa_create_growable()`) grow geometrically to fit, so a run of allocations is amortized O(1). Otherwise, if `RA_NO_CRASH_ON_OVERFLOW` is defined, then this will return `NULL` (and print an error message) when the arena runs out of space. Otherwise, this crash the program.
  * 
  * @param arena The arena to allocate within.
  * @param value A pointer to the value to place in memory.
@@ -98,26 +183,236 @@ void aa_destroy(aa_arena arena);
  */
 void * aa_alloc(aa_arena * arena, void * value, size_t size);
 
+/**
+ * Allocate memory within an arena from several threads at once. Each call claims its space with an atomic compare-and-swap on the arena's position (a lock-free bump) and then copies `value` in, so no two threads ever get overlapping memory. The arena never grows here, since growing would move memory other threads are still writing to; reserve enough up front (`aa_reserve()`). Running out of space behaves like `aa_alloc()`. Don't mix with anything else that touches the arena until the threads are joined.
+ * 
+ * @param arena The arena to allocate within.
+ * @param value A pointer to the value to place in memory.
+ * @param size The amount of memory to allocate.
+ * @return A pointer to the value allocated in the arena. If `RA_CRASH_ON_OVERFLOW` is **not** defined, this will return `NULL` when the arena is out of space.
+ */
+void * aa_alloc_concurrent(aa_arena * arena, const void * value, size_t size);
+
+/**
+ * A handle to a slot of a generational `aa_pool`. Unlike a pointer, a handle to a freed slot is detectably stale: `aa_pool_get()` returns `NULL` for it, even after the slot has been reused. The zero handle is never valid, so it can be used as "none".
+ * 
+ * @param index `unsigned int`, the slot's index in the pool.
+ * @param generation `unsigned int`, the slot's generation when the handle was made. Odd while the slot is in use; bumped on every allocation and free.
+ */
+typedef struct {
+    unsigned int index;
+    unsigned int generation;
+} aa_handle;
+
+/**
+ * Object pool; O(1) allocation and freeing of fixed-size slots, for things that come and go (projectiles, particles, ...) without leaking arena space or going back to `malloc()`. Slots are carved out of fixed-capacity arenas (chunks), a new chunk being added when they're full, so slots never move. Freed slots go on an intrusive free list (the link is stored in the slot itself) and are reused first. A pool is not thread-safe.
+ * 
+ * A slot can also serve as an arena's (and so an array's) memory; see `aa_create_pooled()` and `ra_create_pooled()`.
+ * 
+ * @param chunks `aa_arena`, growable arena of the chunks (`aa_arena`s, `num_chunks` of them), made with the first chunk; the last one is being filled.
+ * @param num_chunks `size_t`, the number of chunks.
+ * @param slot_size `size_t`, the usable size of a slot, in bytes.
+ * @param stride `size_t`, the distance between slots: `slot_size` plus the header (generational pools only), rounded up to 8 bytes.
+ * @param chunk_slots `size_t`, the number of slots per chunk.
+ * @param free_list `void *`, the most recently freed slot, or `NULL`; each free slot points to the next.
+ * @param count `size_t`, the number of slots in use.
+ * @param generational `bool`, whether slots carry a generation, for `aa_handle`s.
+ */
+typedef struct _aa_pool {
+    aa_arena chunks;
+    size_t num_chunks;
+    size_t slot_size;
+    size_t stride;
+    size_t chunk_slots;
+    void * free_list;
+    size_t count;
+    bool generational;
+} aa_pool;
+
+/**
+ * Create an object pool. No memory is allocated until the first slot is. Must be destroyed with `aa_pool_destroy()`.
+ * 
+ * @param slot_size The size of a slot, in bytes (at least `sizeof(void *)` is used, for the free list).
+ * @param chunk_slots The number of slots to allocate at a time.
+ * @param generational Whether slots carry a generation, so that `aa_handle`s to them can be checked. Costs 8 bytes per slot.
+ * @return The pool.
+ */
+aa_pool aa_pool_create(size_t slot_size, size_t chunk_slots, bool generational);
+
+/**
+ * Free a pool's memory, every slot included. Arenas and arrays made from it (`aa_create_pooled()`) must not be used afterwards.
+ * 
+ * @param pool The pool to destroy.
+ */
+void aa_pool_destroy(aa_pool * pool);
+
+/**
+ * Allocate a slot from a pool: a freed one if there is one, otherwise the next one in the last chunk (adding a chunk if it's full).
+ * 
+ * @param pool The pool to allocate from.
+ * @param value A pointer to `slot_size` bytes to copy into the slot, or `NULL` to zero it.
+ * @return A pointer to the slot, `NULL` if a new chunk couldn't be allocated.
+ */
+void * aa_pool_alloc(aa_pool * pool, const void * value);
+
+/**
+ * Return a slot to its pool. On generational pools, freeing a slot that is already free is caught (and ignored).
+ * 
+ * @param pool The pool the slot came from.
+ * @param slot A pointer returned by `aa_pool_alloc()` (or `aa_pool_get()`).
+ */
+void aa_pool_free(aa_pool * pool, void * slot);
+
+/**
+ * Allocate a slot from a generational pool and get a handle to it. See `aa_pool_alloc()`.
+ * 
+ * @param pool The pool to allocate from. Must be generational.
+ * @param value A pointer to `slot_size` bytes to copy into the slot, or `NULL` to zero it.
+ * @return A handle to the slot; the zero handle if allocating failed.
+ */
+aa_handle aa_pool_alloc_handle(aa_pool * pool, const void * value);
+
+/**
+ * Get the slot behind a handle, checking that it hasn't been freed since the handle was made.
+ * 
+ * @param pool The pool the handle came from. Must be generational.
+ * @param handle The handle.
+ * @return A pointer to the slot, `NULL` if the handle is stale (or zero).
+ */
+void * aa_pool_get(aa_pool * pool, aa_handle handle);
+
+/**
+ * Free the slot behind a handle. See `aa_pool_free()`.
+ * 
+ * @param pool The pool the handle came from. Must be generational.
+ * @param handle The handle.
+ * @return `false` (and nothing freed) if the handle is stale (or zero).
+ */
+bool aa_pool_free_handle(aa_pool * pool, aa_handle handle);
+
+/**
+ * Get a handle to a slot in use.
+ * 
+ * @param pool The pool the slot came from. Must be generational.
+ * @param slot A pointer returned by `aa_pool_alloc()`.
+ * @return A handle to the slot; the zero handle if the pool isn't generational or the slot is free.
+ */
+aa_handle aa_pool_handle_of(aa_pool * pool, const void * slot);
+
+/**
+ * Create a fixed-capacity arena whose memory is one slot of a pool (so its capacity is the pool's `slot_size`). `aa_destroy()` gives the slot back. Reserving more than fits (`aa_reserve()`) moves the arena out of the pool and onto the heap; `aa_shrink_to_fit()` leaves pooled arenas alone.
+ * 
+ * @param pool The pool to take the slot from.
+ * @return An arena in a slot of `pool`; its root is `NULL` (and its capacity zero) if allocating failed.
+ */
+aa_arena aa_create_pooled(aa_pool * pool);
+
 //----------------------------
 // array defintions
 
+/**
+ * One chunk of an `ra_strpool`; a fixed-capacity arena in a linked list.
+ * 
+ * @param memory `aa_arena`, the strings in this chunk.
+ * @param next `struct _ra_strchunk *`, the previous (full) chunk, or `NULL`.
+ */
+typedef struct _ra_strchunk {
+    aa_arena memory;
+    struct _ra_strchunk * next;
+} ra_strchunk;
+
+/**
+ * String pool; owns the strings stored in string (`RA_STR`) arrays. It grows by adding chunks rather than reallocating, so stored strings never move. A pool is not thread-safe, but every array gets its own unless one is shared with `ra_set_string_pool()`.
+ * 
+ * @param chunks `ra_strchunk *`, the chunk being filled; the rest follow through `next`.
+ * @param chunk_size `size_t`, the capacity of new chunks (bigger strings get a chunk to themselves).
+ * @param interning `bool`, whether equal strings share storage. If so, strings from the same pool are equal iff their pointers are equal.
+ * @param interned `char **`, open-addressing table of the stored strings, `interned_capacity` long (a power of two). Only used when `interning`.
+ * @param interned_count `size_t`, number of strings in `interned`.
+ */
+typedef struct {
+    ra_strchunk * chunks;
+    size_t chunk_size;
+    bool interning;
+    char ** interned;
+    size_t interned_capacity;
+    size_t interned_count;
+} ra_strpool;
+
+/**
+ * One slot of an `ra_index`.
+ * 
+ * @param hash `size_t`, the full hash of the element, so the table can be grown and probed without rehashing.
+ * @param position `size_t`, the element's index in the array plus one; `0` marks an empty slot.
+ */
+typedef struct {
+    size_t hash;
+    size_t position;
+} ra_index_slot;
+
+/**
+ * Optional hash index of an r_array, for O(1) `ra_member_at()`. Open addressing with linear probing. See `ra_index_enable()`.
+ * 
+ * @param slots `ra_index_slot *`, the table, `capacity` long.
+ * @param capacity `size_t`, number of slots; always a power of two.
+ * @param count `size_t`, number of occupied slots (distinct values in the array).
+ */
+typedef struct {
+    ra_index_slot * slots;
+    size_t capacity;
+    size_t count;
+} ra_index;
+
 /**
  * Dynamic array by Wrzeczak. I don't remember why I prefixed it 'r'.
  * 
  * @param memory `aa_arena`, arena that stores the values.
  * @param type `ra_type`, the type pair of the arena.
  * @param count `size_t`, number of elements in the arena.
+ * @param index `ra_index *`, hash index of the values, or `NULL` if the array isn't indexed (the default).
+ * @param strings `ra_strpool *`, where a string array's strings are stored. Created on the first append if `NULL`.
+ * @param owns_strings `bool`, whether `ra_destroy()` destroys `strings`.
+ * @param sorted `bool`, whether the elements are in order, which lets `ra_member_at()` binary search. Set by `ra_sort()`, cleared by appends and `ra_swap_remove()`. Writing through `ra_get()` doesn't clear it, so set it to `false` yourself if you reorder elements that way.
  */
 typedef struct {
     aa_arena memory;
     ra_type type;
     size_t count;
+    ra_index * index;
+    ra_strpool * strings;
+    bool owns_strings;
+    bool sorted;
 } r_array;
 
+/**
+ * Non-owning, read-only view of (part of) an r_array's elements. Views are plain values: they are free to make, don't need to be destroyed, and can't be appended to or `ra_destroy()`ed. They point into the array's memory, so they are invalidated by anything that moves it (growing, `ra_destroy()`, removals).
+ * 
+ * @param data `const void *`, the first element of the view.
+ * @param count `size_t`, number of elements in the view.
+ * @param stride `ptrdiff_t`, bytes from one element of the view to the next. Can be bigger than the element size (every n-th element) or negative (backwards).
+ * @param typename `const char *`, the typename of the viewed array's type pair.
+ * @param size `int`, the size of the viewed array's type pair (negative for pointer types).
+ */
+typedef struct {
+    const void * data;
+    size_t count;
+    ptrdiff_t stride;
+    const char * typename;
+    int size;
+} ra_view;
+
 #ifndef RA_DEFAULT_ARRAY_CAPACITY
 #define RA_DEFAULT_ARRAY_CAPACITY 512
 #endif
 
+#ifndef RA_DEFAULT_STRING_CHUNK
+#define RA_DEFAULT_STRING_CHUNK 2048
+#endif
+
+#ifndef RA_DEFAULT_GROWTH_FACTOR
+#define RA_DEFAULT_GROWTH_FACTOR 2.0f
+#endif
+
 /**
  * Create an r_array. This allocates the necessary memory, which must be destroyed with `ra_destroy()`.
  * 
@@ -138,6 +433,41 @@ inline r_array ra_create(ra_type type_pair);
  */
 inline r_array ra_create_cap(ra_type type_pair, size_t count);
 
+/**
+ * Create an r_array that grows when it runs out of space instead of overflowing. Growing moves the array's memory, so pointers returned by `ra_get()`, `ra_append()` etc. (and slices) are invalidated by an append that grows it.
+ * 
+ * @param type_pair The type of the array.
+ * @param count The amount of elements to allocate up front.
+ * @param growth The factor to multiply the capacity by when it runs out, e.g. `RA_DEFAULT_GROWTH_FACTOR`. Must be greater than `1.0f`.
+ * @return The new array.
+ */
+r_array ra_create_growable(ra_type type_pair, size_t count, float growth);
+
+/**
+ * Create a fixed-capacity r_array in one slot of a pool, e.g. for lots of small, short-lived arrays of about the same size. It holds `pool->slot_size / abs(type_pair.size)` elements; `ra_reserve()` moves it onto the heap if it needs more. Destroying it with `ra_destroy()` gives the slot back. See `aa_create_pooled()`.
+ * 
+ * @param type_pair The type of the array.
+ * @param pool The pool to take the slot from.
+ * @return The new array.
+ */
+r_array ra_create_pooled(ra_type type_pair, aa_pool * pool);
+
+/**
+ * Make sure an array has room for at least `count` elements. Works on fixed-capacity arrays too. See `aa_reserve()`.
+ * 
+ * @param ra The array to grow.
+ * @param count The minimum number of elements.
+ * @return `false` if the reallocation failed, `true` otherwise.
+ */
+bool ra_reserve(r_array * ra, size_t count);
+
+/**
+ * Shrink an array's memory down to its current `count`. See `aa_shrink_to_fit()`.
+ * 
+ * @param ra The array to shrink.
+ */
+void ra_shrink_to_fit(r_array * ra);
+
 /**
  * Free the memory associated with an array.
  * 
@@ -154,6 +484,44 @@ void ra_destroy(r_array * ra);
  */
 void * ra_append(r_array * ra, ...);
 
+/**
+ * Append `n` elements to an array at once. The space is reserved once and filled with a single `memcpy()`, so this is much cheaper than `n` calls to `ra_append()`. Overflow behaves like `ra_append()`: either all `n` elements are appended or none are. For string arrays every string is still copied individually; running out of array space is still all-or-nothing, but if the string pool can't allocate partway through, the strings before it stay appended.
+ * 
+ * @param ra The array to append to.
+ * @param src Pointer to `n` contiguous values of the type held by `ra` (for string arrays, `n` `char *`).
+ * @param n The number of elements to append.
+ * @return Pointer to the first element appended, `NULL` if appending went wrong.
+ */
+void * ra_append_n(r_array * ra, const void * src, size_t n);
+
+/**
+ * Append an element to an array from several threads at once. The slot is reserved with `aa_alloc_concurrent()`, and `count` is only bumped (atomically) once the element is written, so it never tears and no element is lost. Capacity must be reserved beforehand (`ra_reserve()`), as the array can't grow while other threads write to it. Elements from different threads land in no particular order. Read the array (or `count`) only after the threads are joined. String arrays (the string pool isn't thread-safe) and indexed arrays (see `ra_index_enable()`) aren't supported.
+ * 
+ * @param ra The array to append to.
+ * @param value Pointer to the value to append, of the type held by `ra`.
+ * @return Pointer to the element appended, `NULL` if appending went wrong.
+ */
+void * ra_append_concurrent(r_array * ra, const void * value);
+
+/**
+ * Append `n` elements to an array from several threads at once, contiguously. See `ra_append_concurrent()`; one reservation for all `n`, so batching is much cheaper than `n` single appends under contention.
+ * 
+ * @param ra The array to append to.
+ * @param src Pointer to `n` contiguous values of the type held by `ra`.
+ * @param n The number of elements to append.
+ * @return Pointer to the first element appended, `NULL` if appending went wrong.
+ */
+void * ra_append_n_concurrent(r_array * ra, const void * src, size_t n);
+
+/**
+ * Append all of `src`'s elements to `dst`. See `ra_append_n()`. `dst` and `src` may be the same array.
+ * 
+ * @param dst The array to append to.
+ * @param src The array to append from. Must hold the same type as `dst`.
+ * @return Pointer to the first element appended in `dst`, `NULL` if appending went wrong (including mismatched types).
+ */
+void * ra_extend(r_array * dst, r_array * src);
+
 /**
  * Access the values of an array. Performs bounds checking and returns `NULL` on failure. Negative values count from the back, like in Python, such that `-1` points to the last element of the array, `-2` to the second-to-last, etc.
  * 
@@ -181,13 +549,51 @@ void * ra_get_unsafe(r_array * ra, int idx);
 void * ra_pop(r_array * ra);
 
 /**
- * Remove an element of an array. Shift all the elements behind it back. This function is affected by `RA_NO_CRASH_ON_OVERFLOW`.
+ * Remove an element of an array. Shift all the elements behind it back (one `memmove()`). This function is affected by `RA_NO_CRASH_ON_OVERFLOW`.
  * 
  * @param ra The array to pop from.
- * @return The value popped. This function moves this value to the back of the array, then calls `ra_pop()`.
+ * @return The value popped. Like `ra_pop()`, it is left just past the end of the array, so it is there until overwritten by an append.
  */
 void * ra_pop_at(r_array * ra, int idx);
 
+/**
+ * Remove an element of an array in O(1) by moving the last element into its place. Doesn't preserve order. Bounds are checked like `ra_get()`. On an indexed array (see `ra_index_enable()`), the index is rebuilt, which is O(n).
+ * 
+ * @param ra The array to remove from.
+ * @param idx The index to remove at. Negative values count from the back.
+ * @return The value removed. Like `ra_pop()`, it is left just past the end of the array.
+ */
+void * ra_swap_remove(r_array * ra, int idx);
+
+/**
+ * Remove a range of elements, shifting the rest back with one `memmove()`. Indices work like `ra_slice()`'s. Bounds are checked like `ra_get()`.
+ * 
+ * @param ra The array to remove from.
+ * @param start_idx The beginning of the range, **inclusive**.
+ * @param end_idx The end of the range, **inclusive**.
+ * @return The number of elements removed.
+ */
+size_t ra_remove_range(r_array * ra, int start_idx, int end_idx);
+
+/**
+ * Remove every element for which `pred` returns `true`, in a single pass. The remaining elements keep their order.
+ * 
+ * @param ra The array to remove from.
+ * @param pred Called with a pointer to each element and `ctx`.
+ * @param ctx Passed through to `pred`.
+ * @return The number of elements removed.
+ */
+size_t ra_remove_if(r_array * ra, bool (* pred)(const void * element, void * ctx), void * ctx);
+
+/**
+ * Shrink an array to its first `count` elements. Does nothing if it is already that short.
+ * 
+ * @param ra The array to shrink.
+ * @param count The new number of elements.
+ * @return The number of elements removed.
+ */
+size_t ra_truncate(r_array * ra, size_t count);
+
 
 /**
  * Get a slice of an array. This imitates Python's slice syntax, so negative values are permitted like in `ra_get()`.
@@ -195,12 +601,12 @@ void * ra_pop_at(r_array * ra, int idx);
  * @param ra The array to get a slice of.
  * @param start_idx The beginning of the slice, **inclusive**.
  * @param end_idx The end of the slice, **inclusive**.
- * @return On failure, returns the passed array. On success, returns an array with an internal arena which **points at the passed array's memory**. This does **not** create a new array (i.e. no allocation of new memory, `ra_destroy()` not necessary); see `ra_copy()` for that. The array is completely filled, so (safe) appends will not work. In my opinion you should treat slices as read-only. It might be worth investigating if creating a separate type for slices would help this.
+ * @return On failure, returns the passed array. On success, returns an array with an internal arena which **points at the passed array's memory**. Prefer `ra_view_slice()`, which can't be appended to or destroyed by accident. This does **not** create a new array (i.e. no allocation of new memory, `ra_destroy()` not necessary); see `ra_copy()` for that. The array is completely filled, so (safe) appends will not work. Growing the passed array (see `ra_create_growable()`) invalidates the slice. In my opinion you should treat slices as read-only. It might be worth investigating if creating a separate type for slices would help this.
  */
 r_array ra_slice(r_array * ra, int start_idx, int end_idx);
 
 /**
- * Make a copy of an array. This allocates new memory, and so the new array must be destroyed. To copy a slice, compose this function with `ra_slice()`.
+ * Make a copy of an array. This allocates new memory (of the same capacity), and so the new array must be destroyed. Only the `count` live elements are copied. To copy a slice, compose this function with `ra_slice()`.
  * 
  * @param ra The array to copy.
  * @return A new array with the same data as `ra`, but in a new allocation.
@@ -217,7 +623,7 @@ r_array ra_copy(r_array * ra);
 bool ra_member_of(r_array * ra, ...);
 
 /**
- * Check where a value is in an array.
+ * Check where a value is in an array. This is a linear scan, unless the array has a hash index (see `ra_index_enable()`).
  * 
  * @param ra The array to check in.
  * @param ... The value to check.
@@ -225,6 +631,11 @@ bool ra_member_of(r_array * ra, ...);
  */
 int ra_member_at(r_array * ra, ...);
 
+/**
+ * `ra_member_at()`, taking a `va_list` holding the value.
+ */
+int ra_vmember_at(r_array * ra, va_list args);
+
 /**
  * Print an array with a given format string.
 ```c
@@ -235,245 +646,2519 @@ ra_print(&ra, "%d");
  */
 void ra_printf(r_array * ra, const char * format_string);
 
-//------------------------------------------------------------------------------
+/**
+ * Copy a string into the array's string pool and store the copy's pointer in an array. Used by `ra_append()` and `ra_append_str()`.
+ * 
+ * @param ra The (pointer-typed) array to append to.
+ * @param value The string to copy.
+ * @return Pointer to the element appended, `NULL` if appending went wrong.
+ */
+void * ra_append_string(r_array * ra, const char * value);
 
-aa_arena aa_create(size_t capacity) {
-    aa_arena output = (aa_arena) { malloc(capacity), NULL, capacity };
-    output.position = output.root;
-    memset(output.root, 0, capacity);
-    return output;
-}
+//----------------------------
+// view definitions
 
-void aa_destroy(aa_arena arena) {
-    free(arena.root);
-}
+/**
+ * Get a view of a whole array.
+ * 
+ * @param ra The array to view.
+ * @return A view of all of `ra`'s elements.
+ */
+ra_view ra_view_of(r_array * ra);
 
-void * aa_alloc(aa_arena * arena, void * value, size_t size) {
-    #ifndef RA_NO_CRASH_ON_OVERFLOW
-        if((arena->capacity - (arena->position - arena->root)) < size) {
-            // this print is not silenceable because it crashes. maybe this will be revised in future.
-            printf("aa_alloc: Attempted to allocate %zu bytes in arena <%p>, but there were %zu bytes of space left!\nUndefine RA_CRASH_ON_OVERFLOW to prevent crashing at overflow, and return NULL instead.\n", size, arena, (arena->capacity - (arena->position - arena->root)));
-            exit(80085);
-        }
-    #else
-        if((arena->capacity - (arena->position - arena->root)) < size) {
-            #ifndef RA_SILENT
-            printf("aa_alloc: (RA_NO_CRASH_ON_OVERFLOW) Attempted to allocate %zu bytes in arena <%p>, but there were %zu bytes of space left!\n", size, arena, (arena->capacity - (arena->position - arena->root)));
-            #endif
-            return NULL;
-        }
-    #endif
+/**
+ * Get a view of part of an array. Indices work like `ra_slice()`'s, but `start_idx == end_idx` (one element) is allowed.
+ * 
+ * @param ra The array to view.
+ * @param start_idx The beginning of the view, **inclusive**.
+ * @param end_idx The end of the view, **inclusive**.
+ * @return The view. If the indices are out of bounds or backwards, an empty view (and a message, unless `RA_SILENT`).
+ */
+ra_view ra_view_slice(r_array * ra, int start_idx, int end_idx);
 
-    void * output = arena->position;
+/**
+ * Get a view of part of a view. See `ra_view_slice()`.
+ */
+ra_view ra_view_sub(ra_view view, int start_idx, int end_idx);
 
-    memcpy(arena->position, value, size);
-    arena->position += size;
+/**
+ * Get a view of every `step`-th element of a view, starting with the first. A negative `step` walks backwards from the last element, so `ra_view_step(v, -1)` is `v` reversed.
+ * 
+ * @param view The view to step through.
+ * @param step The step. Must not be `0`.
+ * @return The strided view. If `step` is `0`, `view` is returned.
+ */
+ra_view ra_view_step(ra_view view, int step);
 
-    return output;
-}
+/**
+ * Access an element of a view, with bounds checking like `ra_get()`. Negative values count from the back.
+ * 
+ * @param view The view to access.
+ * @param idx The index to access at.
+ * @return A read-only pointer to the element. Out-of-bounds accesses crash, or return `NULL` if `RA_NO_CRASH_ON_OVERFLOW` is defined.
+ */
+const void * ra_view_get(ra_view view, int idx);
 
-r_array ra_create(ra_type type_pair) {
-    return ra_create_cap(type_pair, RA_DEFAULT_ARRAY_CAPACITY);
-}
+/**
+ * Access an element of a view, without bounds checking. Negative values count from the back.
+ */
+const void * ra_view_get_unsafe(ra_view view, int idx);
 
-r_array ra_create_cap(ra_type type_pair, size_t count) {
-    return (r_array) { .memory = aa_create(count * (size_t) abs(type_pair.size)), .count = 0, .type = type_pair };
-}
+/**
+ * Make a new array holding a copy of a view's elements. Must be destroyed with `ra_destroy()`.
+ * 
+ * @param view The view to copy.
+ * @param type_pair The type pair of the new array; should be the type of the viewed array.
+ * @return The new array, with capacity for exactly `view.count` elements.
+ */
+r_array ra_view_copy(ra_view view, ra_type type_pair);
 
-void ra_destroy(r_array * ra) {
-    aa_destroy(ra->memory);
-}
+/**
+ * `ra_member_at()` for views.
+ */
+int ra_view_member_at(ra_view view, ...);
 
-void * ra_append(r_array * ra, ...) {
-    va_list args;
-    va_start(args, ra);
+/**
+ * `ra_member_of()` for views.
+ */
+bool ra_view_member_of(ra_view view, ...);
 
-    // do not init memory unless it's needed
-    if(!internal_ra_space_for_pointers_has_been_initialized && (ra->type.size < 0)) {
-        ________________internal_ra_space_for_pointers = aa_create(2048);
-        internal_ra_space_for_pointers_has_been_initialized = true;
-    }
+/**
+ * `ra_printf()` for views.
+ */
+void ra_view_printf(ra_view view, const char * format_string);
 
-    #define RA_APPEND_TYPE(pair, _type) \
-        if(strcmp(#_type, ra->type.typename) == 0) { \
-            _type value = va_arg(args, _type); \
-            ra->count++; \
-            return aa_alloc(&ra->memory, &value, sizeof(_type)); \
-        }
-    
-    #define RA_APPEND_PNT_TYPE(pair, _type) \
-        if(strcmp(#_type, ra->type.typename) == 0) { \
+//----------------------------
+// search kernel definitions
+
+// raymath's EPSILON, so the float kernels agree with `Vector2Equals()` and friends
+#define RA_FLOAT_EPSILON 0.000001f
+
+/**
+ * Find the first occurrence of `value` in a buffer of ints. Vectorized (see `RA_NO_SIMD`), so it's memory-bound on big arrays; `ra_member_at()` uses it for contiguous int arrays and views.
+ * 
+ * @param data The buffer, e.g. `(const int *) ra.memory.root`.
+ * @param count The number of ints in the buffer.
+ * @param value The value to look for.
+ * @return The index of the first occurrence, or `-1`.
+ */
+int ra_find_ints(const int * data, size_t count, int value);
+
+/**
+ * Count the occurrences of `value` in a buffer of ints.
+ */
+size_t ra_count_ints(const int * data, size_t count, int value);
+
+/**
+ * Find the smallest and largest values in a buffer of ints.
+ * 
+ * @return `false` (and nothing written) if `count` is `0`.
+ */
+bool ra_minmax_ints(const int * data, size_t count, int * min, int * max);
+
+/**
+ * Sum a buffer of ints. The sum is accumulated in 64 bits, so it doesn't overflow where an int would.
+ */
+long long ra_sum_ints(const int * data, size_t count);
+
+/**
+ * `ra_find_ints()` for doubles. Compares with `==`, like `ra_member_at()` does for `RA_FLOAT`.
+ */
+int ra_find_doubles(const double * data, size_t count, double value);
+
+/**
+ * `ra_count_ints()` for doubles.
+ */
+size_t ra_count_doubles(const double * data, size_t count, double value);
+
+/**
+ * `ra_minmax_ints()` for doubles. NaNs give unspecified results.
+ */
+bool ra_minmax_doubles(const double * data, size_t count, double * min, double * max);
+
+/**
+ * Sum a buffer of doubles. The vectorized version adds in a different order than a plain loop would, so the last bits may differ.
+ */
+double ra_sum_doubles(const double * data, size_t count);
+
+/**
+ * Find the first occurrence of `value` in a buffer of float tuples, e.g. `Vector2` (`components == 2`) or `Vector3` (`components == 3`). Components are compared like raymath's `FloatEquals()`, so this gives the same answer as a `Vector2Equals()` scan.
+ * 
+ * @param data The buffer, as floats.
+ * @param count The number of **tuples** in the buffer.
+ * @param components The number of floats per tuple. Tuples of 1 to 8 floats are vectorized; bigger ones work, but go through the plain C version.
+ * @param value The tuple to look for, `components` floats long.
+ * @return The index of the first matching tuple, or `-1`.
+ */
+int ra_find_floats(const float * data, size_t count, int components, const float * value);
+
+/**
+ * `ra_count_ints()` for float tuples. See `ra_find_floats()`.
+ */
+size_t ra_count_floats(const float * data, size_t count, int components, const float * value);
+
+/**
+ * Component-wise minimum and maximum of a buffer of float tuples, like folding `Vector2Min()`/`Vector2Max()` over it. `min` and `max` must hold `components` floats. NaNs give unspecified results.
+ * 
+ * @return `false` (and nothing written) if `count` is `0`.
+ */
+bool ra_minmax_floats(const float * data, size_t count, int components, float * min, float * max);
+
+/**
+ * Component-wise sum of a buffer of float tuples, like folding `Vector2Add()` over it. `sum` must hold `components` floats.
+ */
+void ra_sum_floats(const float * data, size_t count, int components, float * sum);
+
+/**
+ * Count the occurrences of a value in an array, comparing like `ra_member_at()` does.
+ * 
+ * @param ra The array to search.
+ * @param ... The value to count.
+ * @return The number of elements equal to the value.
+ */
+size_t ra_count_of(r_array * ra, ...);
+
+/**
+ * `ra_count_of()` for views.
+ */
+size_t ra_view_count(ra_view view, ...);
+
+/**
+ * Find the smallest and largest elements of a view of ints, doubles, `Vector2`s or `Vector3`s (component-wise for vectors).
+ * 
+ * @param view The view; must be contiguous (a view of an array, or a slice of one).
+ * @param min Where to write the minimum, as the element type.
+ * @param max Where to write the maximum, as the element type.
+ * @return `false` (and nothing written) if the view is empty, strided, or of another type.
+ */
+bool ra_view_minmax(ra_view view, void * min, void * max);
+
+/**
+ * Sum a view of ints, doubles, `Vector2`s or `Vector3`s (component-wise for vectors).
+ * 
+ * @param view The view; must be contiguous (a view of an array, or a slice of one).
+ * @param sum Where to write the sum: a `long long` for ints, otherwise the element type.
+ * @return `false` (and nothing written) if the view is strided or of another type.
+ */
+bool ra_view_sum(ra_view view, void * sum);
+
+//----------------------------
+// sort definitions
+
+// orderings for `RA_DEFINE_SORT()`; must return nonzero when `a` goes before `b`
+#define RA_LESS_PRIMITIVE(a, b) ((a) < (b))
+#define RA_LESS_STR(a, b) (strcmp((a), (b)) < 0)
+#define RA_LESS_XY(a, b) ((a).x < (b).x || ((a).x == (b).x && (a).y < (b).y))
+#define RA_LESS_XYZ(a, b) ((a).x < (b).x || ((a).x == (b).x && ((a).y < (b).y || ((a).y == (b).y && (a).z < (b).z))))
+
+/**
+ * Sort an array with its type's ordering (ints and doubles by value, strings with `strcmp()`, vectors by x, then y, then z), and mark it `sorted`. The sort isn't stable. Big int and double arrays are radix sorted, everything else is introsorted with an ordering inlined for its type.
+ * 
+ * @param ra The array to sort. If its type has no ordering, nothing happens (and a message is printed, unless `RA_SILENT`).
+ */
+void ra_sort(r_array * ra);
+
+/**
+ * Find where a value would go in a sorted array.
+ * 
+ * @param ra The array to search; must be sorted.
+ * @param ... The value to look for.
+ * @return The index of the first element that doesn't go before the value, or `ra->count` if there is none.
+ */
+size_t ra_lower_bound(r_array * ra, ...);
+
+/**
+ * Binary search a sorted array. Unlike `ra_member_at()`, this compares with the type's ordering, so e.g. `Vector2`s have to match exactly.
+ * 
+ * @param ra The array to search; must be sorted (a message is printed if it isn't marked `sorted`, unless `RA_SILENT`).
+ * @param ... The value to look for.
+ * @return The index of the first matching element, or `-1`.
+ */
+int ra_bsearch(r_array * ra, ...);
+
+/**
+ * Define `ra_sort_data_<name>()`, `ra_lower_bound_data_<name>()` and `ra_find_sorted_data_<name>()`, which sort and search plain buffers of a type with `less` inlined. `ra_sort()` and the typed sort functions use these.
+ * 
+ * @param pair The type pair, e.g. `RA_VECTOR2`.
+ * @param _type The C type, e.g. `Vector2`.
+ * @param name The suffix used in the generated names, e.g. `Vector2`.
+ * @param less Ordering, e.g. `RA_LESS_XY`.
+ * @param radix How to radix sort big buffers instead: `RA_RADIX_INTS` or `RA_RADIX_DOUBLES` for those types under `RA_LESS_PRIMITIVE`, otherwise `RA_RADIX_NONE`.
+ */
+#define RA_DEFINE_SORT(pair, _type, name, less, radix) \
+    void ra_internal_insertion_sort_##name(_type * data, size_t count) { \
+        for(size_t i = 1; i < count; i++) { \
+            _type value = data[i]; \
+            size_t j = i; \
+            for(; j > 0 && less(value, data[j - 1]); j--) data[j] = data[j - 1]; \
+            data[j] = value; \
+        } \
+    } \
+    void ra_internal_sift_down_##name(_type * data, size_t root, size_t count) { \
+        _type value = data[root]; \
+        for(size_t child = 2 * root + 1; child < count; child = 2 * root + 1) { \
+            if(child + 1 < count && less(data[child], data[child + 1])) child++; \
+            if(!less(value, data[child])) break; \
+            data[root] = data[child]; \
+            root = child; \
+        } \
+        data[root] = value; \
+    } \
+    void ra_internal_introsort_##name(_type * data, size_t count, int depth) { \
+        while(count > 16) { \
+            if(depth-- == 0) { \
+                /* too many bad pivots; heapsort is O(n log n) no matter what */ \
+                for(size_t i = count / 2; i-- > 0;) ra_internal_sift_down_##name(data, i, count); \
+                for(size_t end = count - 1; end > 0; end--) { \
+                    RA_INTERNAL_SWAP(_type, data[0], data[end]); \
+                    ra_internal_sift_down_##name(data, 0, end); \
+                } \
+                return; \
+            } \
+            /* median of three, so neither partition loop can run off the ends */ \
+            size_t mid = count / 2; \
+            if(less(data[mid], data[0])) RA_INTERNAL_SWAP(_type, data[mid], data[0]); \
+            if(less(data[count - 1], data[mid])) { \
+                RA_INTERNAL_SWAP(_type, data[count - 1], data[mid]); \
+                if(less(data[mid], data[0])) RA_INTERNAL_SWAP(_type, data[mid], data[0]); \
+            } \
+            _type pivot = data[mid]; \
+            size_t i = 0; \
+            size_t j = count - 1; \
+            for(;;) { \
+                while(less(data[i], pivot)) i++; \
+                while(less(pivot, data[j])) j--; \
+                if(i >= j) break; \
+                RA_INTERNAL_SWAP(_type, data[i], data[j]); \
+                i++; \
+                j--; \
+            } \
+            /* recurse into the smaller side, loop on the bigger one, so the stack stays O(log n) */ \
+            size_t left = j + 1; \
+            if(left < count - left) { \
+                ra_internal_introsort_##name(data, left, depth); \
+                data += left; \
+                count -= left; \
+            } else { \
+                ra_internal_introsort_##name(data + left, count - left, depth); \
+                count = left; \
+            } \
+        } \
+        ra_internal_insertion_sort_##name(data, count); \
+    } \
+    void ra_sort_data_##name(_type * data, size_t count) { \
+        if(radix(data, count)) return; \
+        int depth = 0; \
+        for(size_t n = count; n > 1; n >>= 1) depth += 2; \
+        ra_internal_introsort_##name(data, count, depth); \
+    } \
+    size_t ra_lower_bound_data_##name(_type const * data, size_t count, _type value) { \
+        size_t lo = 0; \
+        size_t hi = count; \
+        while(lo < hi) { \
+            size_t mid = lo + (hi - lo) / 2; \
+            if(less(data[mid], value)) lo = mid + 1; \
+            else hi = mid; \
+        } \
+        return lo; \
+    } \
+    int ra_find_sorted_data_##name(_type const * data, size_t count, _type value) { \
+        size_t idx = ra_lower_bound_data_##name(data, count, value); \
+        return (idx < count && !less(value, data[idx])) ? (int) idx : -1; \
+    }
+
+// `radix` for `RA_DEFINE_SORT()`
+#define RA_RADIX_NONE(data, count) false
+#define RA_RADIX_INTS(data, count) ra_internal_radix_sort(data, count, sizeof(int), false)
+#define RA_RADIX_DOUBLES(data, count) ra_internal_radix_sort(data, count, sizeof(double), true)
+
+#define RA_INTERNAL_SWAP(_type, a, b) do { _type swap_value = (a); (a) = (b); (b) = swap_value; } while(0)
+
+//----------------------------
+// string pool definitions
+
+/**
+ * Create a string pool. Must be destroyed with `ra_strpool_destroy()`, unless it is handed to an array with `ra_set_string_pool(..., true)`.
+ * 
+ * @param chunk_size The capacity, in bytes, of each chunk, e.g. `RA_DEFAULT_STRING_CHUNK`.
+ * @param interning Whether to store each distinct string only once.
+ * @return The new pool, or `NULL` if allocation failed.
+ */
+ra_strpool * ra_strpool_create(size_t chunk_size, bool interning);
+
+/**
+ * Free a string pool and every string in it.
+ * 
+ * @param pool The pool to destroy.
+ */
+void ra_strpool_destroy(ra_strpool * pool);
+
+/**
+ * Copy a string into a pool. If the pool is interning and already holds an equal string, that one is returned instead.
+ * 
+ * @param pool The pool to store in.
+ * @param value The string to copy.
+ * @return The pool's copy of the string, `NULL` if allocation failed.
+ */
+char * ra_strpool_add(ra_strpool * pool, const char * value);
+
+/**
+ * Find the interned copy of a string.
+ * 
+ * @param pool The pool to look in. Must be interning.
+ * @param value The string to look for.
+ * @return The pool's copy of the string, or `NULL` if it isn't in the pool.
+ */
+char * ra_strpool_find(ra_strpool * pool, const char * value);
+
+/**
+ * Make a string array store its strings in `pool`, e.g. to share one interning pool between several arrays. Must be called before anything is appended.
+ * 
+ * @param ra The array in question.
+ * @param pool The pool to use.
+ * @param take_ownership Whether `ra_destroy(ra)` should destroy `pool`.
+ */
+void ra_set_string_pool(r_array * ra, ra_strpool * pool, bool take_ownership);
+
+//----------------------------
+// hash index definitions
+
+/**
+ * Attach a hash index to an array, so `ra_member_at()` and `ra_member_of()` (and their typed versions) are O(1). The index is kept up to date by `ra_append()`, `ra_append_n()`, `ra_pop()` and `ra_pop_at()`, and freed by `ra_destroy()`. Writing to elements through `ra_get()` does **not** update it; call `ra_index_rebuild()` afterwards.
+ * 
+ * Only types whose equality is exact can be indexed: integers, strings, and other types without a comparison function, except floating point. The others (`RA_FLOAT`, `RA_VECTOR2`, ...) keep scanning.
+ * 
+ * @param ra The array to index.
+ * @return `false` if the type can't be indexed or the index couldn't be allocated, `true` otherwise.
+ */
+bool ra_index_enable(r_array * ra);
+
+/**
+ * Free an array's hash index. `ra_member_at()` goes back to scanning.
+ * 
+ * @param ra The array in question.
+ */
+void ra_index_disable(r_array * ra);
+
+/**
+ * Rebuild an array's hash index from scratch, e.g. after modifying elements in place.
+ * 
+ * @param ra The array in question. Must already have an index.
+ */
+void ra_index_rebuild(r_array * ra);
+
+/**
+ * Look up a value in an array's hash index.
+ * 
+ * @param ra The array to check in. Must have an index.
+ * @param element Pointer to the value to look for (for string arrays, a pointer to the `char *`).
+ * @return `-1` if not in the array; otherwise, the index of its first occurrence.
+ */
+int ra_index_find(r_array * ra, const void * element);
+
+/**
+ * Add the element at `idx` to an array's hash index. If an equal value is already indexed, this does nothing (the index keeps the first occurrence). Called by the append functions.
+ * 
+ * @param ra The array in question. Must have an index.
+ * @param idx The (positive) index of the element to add.
+ */
+void ra_index_insert(r_array * ra, size_t idx);
+
+/**
+ * Remove the element at `idx` from an array's hash index, if it is the occurrence being indexed. Called by `ra_pop()` before the element is removed.
+ * 
+ * @param ra The array in question. Must have an index.
+ * @param idx The (positive) index of the element to remove.
+ */
+void ra_index_remove(r_array * ra, size_t idx);
+
+//----------------------------
+// typed array definitions
+
+// equality predicates for `RA_DEFINE_TYPED()`; must return nonzero when equal
+#define RA_EQ_PRIMITIVE(a, b) ((a) == (b))
+#define RA_EQ_STR(a, b) (strcmp((a), (b)) == 0)
+
+// the part of the typed API that doesn't depend on how values are stored or compared
+#define RA_DEFINE_TYPED_COMMON(pair, _type, name) \
+    typedef struct { r_array ra; } r_array_##name; \
+    static inline r_array_##name ra_create_##name(void) { return (r_array_##name) { ra_create(pair) }; } \
+    static inline r_array_##name ra_create_cap_##name(size_t count) { return (r_array_##name) { ra_create_cap(pair, count) }; } \
+    static inline r_array_##name ra_create_growable_##name(size_t count, float growth) { return (r_array_##name) { ra_create_growable(pair, count, growth) }; } \
+    static inline r_array_##name ra_create_pooled_##name(aa_pool * pool) { return (r_array_##name) { ra_create_pooled(pair, pool) }; } \
+    static inline void ra_destroy_##name(r_array_##name * a) { ra_destroy(&a->ra); } \
+    static inline bool ra_reserve_##name(r_array_##name * a, size_t count) { return ra_reserve(&a->ra, count); } \
+    static inline void ra_shrink_to_fit_##name(r_array_##name * a) { ra_shrink_to_fit(&a->ra); } \
+    static inline _type * ra_get_##name(r_array_##name * a, int idx) { \
+        if((idx >= (int) a->ra.count) || (idx < (-1 * (int) a->ra.count))) return (_type *) ra_get(&a->ra, idx); \
+        return ((_type *) a->ra.memory.root) + ((idx >= 0) ? idx : ((int) a->ra.count + idx)); \
+    } \
+    static inline _type * ra_pop_##name(r_array_##name * a) { return (_type *) ra_pop(&a->ra); } \
+    static inline _type * ra_pop_at_##name(r_array_##name * a, int idx) { return (_type *) ra_pop_at(&a->ra, idx); } \
+    static inline _type * ra_swap_remove_##name(r_array_##name * a, int idx) { return (_type *) ra_swap_remove(&a->ra, idx); } \
+    static inline size_t ra_remove_range_##name(r_array_##name * a, int start_idx, int end_idx) { return ra_remove_range(&a->ra, start_idx, end_idx); } \
+    static inline size_t ra_remove_if_##name(r_array_##name * a, bool (* pred)(_type const * element, void * ctx), void * ctx) { \
+        _type * data = (_type *) a->ra.memory.root; \
+        size_t kept = 0; \
+        for(size_t i = 0; i < a->ra.count; i++) { \
+            if(pred(&data[i], ctx)) continue; \
+            if(kept != i) data[kept] = data[i]; \
+            kept++; \
+        } \
+        return ra_truncate(&a->ra, kept); \
+    } \
+    static inline _type * ra_append_n_##name(r_array_##name * a, _type const * src, size_t n) { return (_type *) ra_append_n(&a->ra, src, n); } \
+    static inline _type * ra_extend_##name(r_array_##name * dst, r_array_##name * src) { return (_type *) ra_extend(&dst->ra, &src->ra); }
+
+/**
+ * Define a strongly-typed array `r_array_<name>` and its API for a type pair. The typed functions know the element type at compile time, so e.g. `ra_append_<name>()` is a capacity check plus a store, and can be inlined. Out-of-space and out-of-bounds cases fall through to the generic functions, so `RA_NO_CRASH_ON_OVERFLOW` and `RA_SILENT` behave the same.
+ * 
+ * @param pair The type pair, e.g. `RA_VECTOR2`.
+ * @param _type The C type held, e.g. `Vector2`.
+ * @param name The suffix used in the generated names, e.g. `Vector2`.
+ * @param eq Equality predicate used by `ra_member_at_<name>()`.
+ * @param find How `ra_member_at_<name>()` scans: a search kernel that agrees with `eq` (`RA_FIND_INTS`, `RA_FIND_DOUBLES`, `RA_FIND_FLOATS2`, `RA_FIND_FLOATS3`), or `RA_FIND_SCAN`, a plain `eq` loop.
+ * @param sorted_find How it searches arrays marked `sorted`: `RA_FIND_SORTED`, a binary search (needs `RA_DEFINE_SORT()`, and an ordering that agrees with `eq`), or the same as `find`.
+ */
+#define RA_DEFINE_TYPED(pair, _type, name, eq, find, sorted_find) \
+    RA_DEFINE_TYPED_COMMON(pair, _type, name) \
+    static inline int ra_internal_scan_##name(_type const * data, size_t count, _type value) { \
+        for(size_t i = 0; i < count; i++) { \
+            if(eq(value, data[i])) return (int) i; \
+        } \
+        return -1; \
+    } \
+    static inline _type * ra_append_##name(r_array_##name * a, _type value) { \
+        _type * slot; \
+        if((size_t) (a->ra.memory.position - a->ra.memory.root) + sizeof(_type) > a->ra.memory.capacity) { \
+            slot = aa_alloc(&a->ra.memory, &value, sizeof(_type)); \
+            if(slot == NULL) return NULL; \
+        } else { \
+            slot = (_type *) a->ra.memory.position; \
+            *slot = value; \
+            a->ra.memory.position += sizeof(_type); \
+        } \
+        a->ra.count++; \
+        a->ra.sorted = false; \
+        if(a->ra.index != NULL) ra_index_insert(&a->ra, a->ra.count - 1); \
+        return slot; \
+    } \
+    static inline _type * ra_append_concurrent_##name(r_array_##name * a, _type value) { return (_type *) ra_append_concurrent(&a->ra, &value); } \
+    static inline _type * ra_append_n_concurrent_##name(r_array_##name * a, _type const * src, size_t n) { return (_type *) ra_append_n_concurrent(&a->ra, src, n); } \
+    static inline int ra_member_at_##name(r_array_##name * a, _type value) { \
+        if(a->ra.index != NULL) return ra_index_find(&a->ra, &value); \
+        if(a->ra.sorted) return sorted_find(name, (_type const *) a->ra.memory.root, a->ra.count, value); \
+        return find(name, (_type const *) a->ra.memory.root, a->ra.count, value); \
+    } \
+    static inline bool ra_member_of_##name(r_array_##name * a, _type value) { return (ra_member_at_##name(a, value) >= 0); }
+
+// `find` and `sorted_find` for `RA_DEFINE_TYPED()`; chosen when the macro expands, so typed lookups don't go through `ra_internal_kernels[]`
+#define RA_FIND_SCAN(name, data, count, value) ra_internal_scan_##name(data, count, value)
+#define RA_FIND_INTS(name, data, count, value) ra_find_ints(data, count, value)
+#define RA_FIND_DOUBLES(name, data, count, value) ra_find_doubles(data, count, value)
+#define RA_FIND_FLOATS2(name, data, count, value) ra_find_floats((const float *) (data), count, 2, (const float *) &(value))
+#define RA_FIND_FLOATS3(name, data, count, value) ra_find_floats((const float *) (data), count, 3, (const float *) &(value))
+#define RA_FIND_SORTED(name, data, count, value) ra_find_sorted_data_##name(data, count, value)
+
+/**
+ * Like `RA_DEFINE_TYPED()`, but for pointer (string) types. Appending copies the string like `ra_append()` does.
+ */
+#define RA_DEFINE_TYPED_PNT(pair, _type, name, eq) \
+    RA_DEFINE_TYPED_COMMON(pair, _type, name) \
+    static inline _type * ra_append_##name(r_array_##name * a, const _type value) { return (_type *) ra_append_string(&a->ra, value); } \
+    static inline int ra_member_at_##name(r_array_##name * a, const _type value) { \
+        if(a->ra.index != NULL) return ra_index_find(&a->ra, &value); \
+        _type * data = (_type *) a->ra.memory.root; \
+        if(a->ra.strings != NULL && a->ra.strings->interning) { \
+            _type interned = ra_strpool_find(a->ra.strings, value); \
+            if(interned == NULL) return -1; \
+            for(size_t i = 0; i < a->ra.count; i++) { \
+                if(interned == data[i]) return (int) i; \
+            } \
+            return -1; \
+        } \
+        for(size_t i = 0; i < a->ra.count; i++) { \
+            if(eq(value, data[i])) return (int) i; \
+        } \
+        return -1; \
+    } \
+    static inline bool ra_member_of_##name(r_array_##name * a, const _type value) { return (ra_member_at_##name(a, value) >= 0); }
+
+/**
+ * Add `ra_sort_<name>()`, `ra_lower_bound_<name>()` and `ra_bsearch_<name>()` to a typed array with an ordering. Needs `RA_DEFINE_SORT()` for the same type.
+ */
+#define RA_DEFINE_TYPED_ORDERED(pair, _type, name, less) \
+    static inline void ra_sort_##name(r_array_##name * a) { \
+        ra_sort_data_##name((_type *) a->ra.memory.root, a->ra.count); \
+        ra_internal_mark_sorted(&a->ra); \
+    } \
+    static inline size_t ra_lower_bound_##name(r_array_##name * a, _type value) { return ra_lower_bound_data_##name((_type *) a->ra.memory.root, a->ra.count, value); } \
+    static inline int ra_bsearch_##name(r_array_##name * a, _type value) { return ra_find_sorted_data_##name((_type *) a->ra.memory.root, a->ra.count, value); }
+
+//------------------------------------------------------------------------------
+
+// FNV-1a
+size_t ra_internal_hash_bytes(const unsigned char * bytes, size_t size) {
+    unsigned long long hash = 14695981039346656037ULL;
+    for(size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return (size_t) hash;
+}
+
+aa_arena aa_create(size_t capacity) {
+    #ifdef RA_NO_ZERO
+    return aa_create_unzeroed(capacity);
+    #else
+    aa_arena output = (aa_arena) { .root = calloc(capacity, 1), .capacity = capacity };
+    output.position = output.root;
+    return output;
+    #endif
+}
+
+aa_arena aa_create_unzeroed(size_t capacity) {
+    aa_arena output = (aa_arena) { .root = malloc(capacity), .capacity = capacity };
+    output.position = output.root;
+    return output;
+}
+
+aa_arena aa_create_growable(size_t capacity, float growth) {
+    aa_arena output = aa_create(capacity);
+    output.growth = growth;
+    return output;
+}
+
+void aa_destroy(aa_arena arena) {
+    if(arena.pool != NULL) aa_pool_free(arena.pool, arena.root);
+    else free(arena.root);
+}
+
+bool aa_reserve(aa_arena * arena, size_t capacity) {
+    if(capacity <= arena->capacity) return true;
+
+    size_t used = arena->position - arena->root;
+    if(arena->pool != NULL) {
+        // a slot can't be realloc()ed; move out of the pool instead
+        void * root = malloc(capacity);
+        if(root == NULL) return false;
+
+        memcpy(root, arena->root, used);
+        aa_pool_free(arena->pool, arena->root);
+        arena->pool = NULL;
+        arena->root = root;
+        arena->position = root + used;
+        arena->capacity = capacity;
+        return true;
+    }
+
+    void * root = realloc(arena->root, capacity);
+    if(root == NULL) return false;
+
+    arena->root = root;
+    arena->position = root + used;
+    arena->capacity = capacity;
+    return true;
+}
+
+void aa_shrink_to_fit(aa_arena * arena) {
+    if(arena->pool != NULL) return; // slots are all the same size anyway
+
+    size_t used = arena->position - arena->root;
+    if(used == 0 || used == arena->capacity) return; // realloc(p, 0) is implementation-defined, so leave empty arenas alone
+
+    void * root = realloc(arena->root, used);
+    if(root == NULL) return;
+
+    arena->root = root;
+    arena->position = root + used;
+    arena->capacity = used;
+}
+
+bool aa_grow_for(aa_arena * arena, size_t size) {
+    size_t used = arena->position - arena->root;
+    if((arena->capacity - used) >= size) return true;
+    if(arena->growth <= 1.0f) return false;
+
+    size_t new_capacity = (size_t) ((float) arena->capacity * arena->growth);
+    if(new_capacity < used + size) new_capacity = used + size;
+    return aa_reserve(arena, new_capacity);
+}
+
+void * aa_alloc(aa_arena * arena, void * value, size_t size) {
+    aa_grow_for(arena, size); // on failure, fall through to the overflow handling below
+
+    #ifndef RA_NO_CRASH_ON_OVERFLOW
+        if((arena->capacity - (arena->position - arena->root)) < size) {
+            // this print is not silenceable because it crashes. maybe this will be revised in future.
+            printf("aa_alloc: Attempted to allocate %zu bytes in arena <%p>, but there were %zu bytes of space left!\nUndefine RA_CRASH_ON_OVERFLOW to prevent crashing at overflow, and return NULL instead.\n", size, arena, (arena->capacity - (arena->position - arena->root)));
+            exit(80085);
+        }
+    #else
+        if((arena->capacity - (arena->position - arena->root)) < size) {
+            #ifndef RA_SILENT
+            printf("aa_alloc: (RA_NO_CRASH_ON_OVERFLOW) Attempted to allocate %zu bytes in arena <%p>, but there were %zu bytes of space left!\n", size, arena, (arena->capacity - (arena->position - arena->root)));
+            #endif
+            return NULL;
+        }
+    #endif
+
+    void * output = arena->position;
+
+    memcpy(arena->position, value, size);
+    arena->position += size;
+
+    return output;
+}
+
+// the atomics the concurrent appends are built on: GCC/Clang builtins, or MSVC's interlocked intrinsics (from <intrin.h>). Other compilers don't get concurrent appends at all
+#if !defined(__GNUC__) && !defined(__clang__) && !defined(_MSC_VER)
+    #define RA_INTERNAL_NO_ATOMICS
+#else
+void * ra_internal_atomic_load_pointer(void * const * p) {
+    #if defined(__GNUC__) || defined(__clang__)
+    return __atomic_load_n(p, __ATOMIC_RELAXED);
+    #else
+    return *(void * const volatile *) p;
+    #endif
+}
+
+// on failure, `*expected` is reloaded with the pointer found instead
+bool ra_internal_atomic_cas_pointer(void ** p, void ** expected, void * desired) {
+    #if defined(__GNUC__) || defined(__clang__)
+    return __atomic_compare_exchange_n(p, expected, desired, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+    #else
+    void * seen = _InterlockedCompareExchangePointer((void * volatile *) p, desired, *expected);
+    if(seen == *expected) return true;
+    *expected = seen;
+    return false;
+    #endif
+}
+
+// a release, so whoever sees the new value also sees what was written before it
+void ra_internal_atomic_add_size(size_t * p, size_t n) {
+    #if defined(__GNUC__) || defined(__clang__)
+    __atomic_fetch_add(p, n, __ATOMIC_RELEASE);
+    #elif defined(_WIN64)
+    _InterlockedExchangeAdd64((volatile long long *) p, (long long) n);
+    #else
+    _InterlockedExchangeAdd((volatile long *) p, (long) n);
+    #endif
+}
+
+void ra_internal_atomic_store_bool(bool * p, bool value) {
+    #if defined(__GNUC__) || defined(__clang__)
+    __atomic_store_n(p, value, __ATOMIC_RELAXED);
+    #else
+    *(volatile bool *) p = value;
+    #endif
+}
+#endif
+
+void * aa_alloc_concurrent(aa_arena * arena, const void * value, size_t size) {
+    #ifdef RA_INTERNAL_NO_ATOMICS
+    #ifndef RA_SILENT
+    printf("aa_alloc_concurrent: No atomics known for this compiler; can't allocate in arena <%p> concurrently!\n", arena);
+    #endif
+    return NULL;
+    #else
+    void * output = ra_internal_atomic_load_pointer(&arena->position);
+
+    // on failure, the compare-and-swap reloads `output` with whatever another thread bumped the position to
+    do {
+        size_t left = arena->capacity - (size_t) (output - arena->root);
+        if(left < size) {
+            #ifndef RA_NO_CRASH_ON_OVERFLOW
+                printf("aa_alloc_concurrent: Attempted to allocate %zu bytes in arena <%p>, but there were %zu bytes of space left!\nReserve enough space before appending concurrently.\n", size, arena, left);
+                exit(80085);
+            #else
+                #ifndef RA_SILENT
+                printf("aa_alloc_concurrent: (RA_NO_CRASH_ON_OVERFLOW) Attempted to allocate %zu bytes in arena <%p>, but there were %zu bytes of space left!\n", size, arena, left);
+                #endif
+                return NULL;
+            #endif
+        }
+    } while(!ra_internal_atomic_cas_pointer(&arena->position, &output, output + size));
+
+    memcpy(output, value, size);
+    return output;
+    #endif
+}
+
+// a generational slot's header; `index` is fixed when the slot is first carved out of a chunk
+typedef struct {
+    unsigned int generation;
+    unsigned int index;
+} aa_internal_slot_header;
+
+aa_internal_slot_header * aa_internal_slot_header_of(const void * slot) {
+    return (aa_internal_slot_header *) ((char *) slot - sizeof(aa_internal_slot_header));
+}
+
+aa_pool aa_pool_create(size_t slot_size, size_t chunk_slots, bool generational) {
+    size_t stride = ((slot_size > sizeof(void *)) ? slot_size : sizeof(void *)) + ((generational) ? sizeof(aa_internal_slot_header) : 0);
+    stride = (stride + 7) & ~((size_t) 7);
+
+    return (aa_pool) {
+        .slot_size = slot_size,
+        .stride = stride,
+        .chunk_slots = (chunk_slots == 0) ? 1 : chunk_slots,
+        .generational = generational
+    };
+}
+
+void aa_pool_destroy(aa_pool * pool) {
+    aa_arena * chunks = (aa_arena *) pool->chunks.root;
+    for(size_t i = 0; i < pool->num_chunks; i++) aa_destroy(chunks[i]);
+    aa_destroy(pool->chunks);
+
+    pool->chunks = (aa_arena) { 0 };
+    pool->num_chunks = 0;
+    pool->free_list = NULL;
+    pool->count = 0;
+}
+
+void * aa_pool_alloc(aa_pool * pool, const void * value) {
+    void * slot = pool->free_list;
+
+    if(slot != NULL) {
+        pool->free_list = *(void **) slot;
+    } else {
+        aa_arena * chunk = (pool->num_chunks == 0) ? NULL : ((aa_arena *) pool->chunks.root) + pool->num_chunks - 1;
+
+        if(chunk == NULL || (size_t) (chunk->position - chunk->root) + pool->stride > chunk->capacity) {
+            // the chunk table itself is made with the first chunk
+            if(pool->chunks.root == NULL) pool->chunks = aa_create_growable(4 * sizeof(aa_arena), RA_DEFAULT_GROWTH_FACTOR);
+
+            aa_arena fresh = aa_create_unzeroed(pool->chunk_slots * pool->stride);
+            if(fresh.root == NULL || pool->chunks.root == NULL || aa_alloc(&pool->chunks, &fresh, sizeof(aa_arena)) == NULL) {
+                #ifndef RA_SILENT
+                printf("aa_pool_alloc: Couldn't allocate a chunk of %zu slots for pool <%p>!\n", pool->chunk_slots, pool);
+                #endif
+                free(fresh.root);
+                return NULL;
+            }
+            pool->num_chunks++;
+            chunk = ((aa_arena *) pool->chunks.root) + pool->num_chunks - 1;
+        }
+
+        slot = chunk->position;
+        chunk->position += pool->stride;
+
+        if(pool->generational) {
+            aa_internal_slot_header * header = slot;
+            header->generation = 0;
+            header->index = (unsigned int) ((pool->num_chunks - 1) * pool->chunk_slots + (size_t) (slot - chunk->root) / pool->stride);
+            slot += sizeof(aa_internal_slot_header);
+        }
+    }
+
+    if(pool->generational) aa_internal_slot_header_of(slot)->generation++;
+    pool->count++;
+
+    if(value != NULL) memcpy(slot, value, pool->slot_size);
+    else memset(slot, 0, pool->slot_size);
+    return slot;
+}
+
+void aa_pool_free(aa_pool * pool, void * slot) {
+    if(slot == NULL) return;
+
+    if(pool->generational) {
+        aa_internal_slot_header * header = aa_internal_slot_header_of(slot);
+        if((header->generation & 1) == 0) {
+            #ifndef RA_SILENT
+            printf("aa_pool_free: Slot <%p> of pool <%p> was already free!\n", slot, pool);
+            #endif
+            return;
+        }
+        header->generation++;
+    }
+
+    *(void **) slot = pool->free_list;
+    pool->free_list = slot;
+    pool->count--;
+}
+
+// whether a pool is generational, complaining if not
+bool aa_internal_pool_check_generational(aa_pool * pool, const char * caller) {
+    if(pool->generational) return true;
+
+    #ifndef RA_SILENT
+    printf("%s: Pool <%p> isn't generational, so it has no handles!\n", caller, pool);
+    #endif
+    return false;
+}
+
+aa_handle aa_pool_alloc_handle(aa_pool * pool, const void * value) {
+    if(!aa_internal_pool_check_generational(pool, "aa_pool_alloc_handle")) return (aa_handle) { 0 };
+
+    void * slot = aa_pool_alloc(pool, value);
+    if(slot == NULL) return (aa_handle) { 0 };
+
+    aa_internal_slot_header * header = aa_internal_slot_header_of(slot);
+    return (aa_handle) { header->index, header->generation };
+}
+
+void * aa_pool_get(aa_pool * pool, aa_handle handle) {
+    if(!aa_internal_pool_check_generational(pool, "aa_pool_get")) return NULL;
+    if((handle.generation & 1) == 0 || handle.index >= pool->num_chunks * pool->chunk_slots) return NULL;
+
+    aa_arena * chunk = ((aa_arena *) pool->chunks.root) + handle.index / pool->chunk_slots;
+    size_t offset = (handle.index % pool->chunk_slots) * pool->stride;
+    if(offset >= (size_t) (chunk->position - chunk->root)) return NULL; // never handed out
+
+    aa_internal_slot_header * header = chunk->root + offset;
+    return (header->generation == handle.generation) ? (void *) (header + 1) : NULL;
+}
+
+bool aa_pool_free_handle(aa_pool * pool, aa_handle handle) {
+    void * slot = aa_pool_get(pool, handle);
+    if(slot == NULL) return false;
+
+    aa_pool_free(pool, slot);
+    return true;
+}
+
+aa_handle aa_pool_handle_of(aa_pool * pool, const void * slot) {
+    if(slot == NULL || !aa_internal_pool_check_generational(pool, "aa_pool_handle_of")) return (aa_handle) { 0 };
+
+    aa_internal_slot_header * header = aa_internal_slot_header_of(slot);
+    if((header->generation & 1) == 0) return (aa_handle) { 0 };
+    return (aa_handle) { header->index, header->generation };
+}
+
+aa_arena aa_create_pooled(aa_pool * pool) {
+    void * slot = aa_pool_alloc(pool, NULL);
+    if(slot == NULL) return (aa_arena) { 0 };
+
+    return (aa_arena) { .root = slot, .position = slot, .capacity = pool->slot_size, .pool = pool };
+}
+
+r_array ra_create(ra_type type_pair) {
+    return ra_create_cap(type_pair, RA_DEFAULT_ARRAY_CAPACITY);
+}
+
+r_array ra_create_cap(ra_type type_pair, size_t count) {
+    return (r_array) { .memory = aa_create(count * (size_t) abs(type_pair.size)), .count = 0, .type = type_pair };
+}
+
+r_array ra_create_growable(ra_type type_pair, size_t count, float growth) {
+    return (r_array) { .memory = aa_create_growable(count * (size_t) abs(type_pair.size), growth), .count = 0, .type = type_pair };
+}
+
+r_array ra_create_pooled(ra_type type_pair, aa_pool * pool) {
+    return (r_array) { .memory = aa_create_pooled(pool), .count = 0, .type = type_pair };
+}
+
+bool ra_reserve(r_array * ra, size_t count) {
+    return aa_reserve(&ra->memory, count * (size_t) abs(ra->type.size));
+}
+
+void ra_shrink_to_fit(r_array * ra) {
+    aa_shrink_to_fit(&ra->memory);
+}
+
+void ra_destroy(r_array * ra) {
+    aa_destroy(ra->memory);
+    ra_index_disable(ra);
+    if(ra->owns_strings && ra->strings != NULL) ra_strpool_destroy(ra->strings);
+    ra->strings = NULL;
+}
+
+void * ra_append(r_array * ra, ...) {
+    va_list args;
+    va_start(args, ra);
+
+    // `...` promotes float to double and char/short to int, so those are read back as `_promoted`
+    #define RA_APPEND_PROMOTED_TYPE(pair, _type, _promoted) \
+        if(strcmp(#_type, ra->type.typename) == 0) { \
+            _type value = va_arg(args, _promoted); \
+            va_end(args); \
+            void * output = aa_alloc(&ra->memory, &value, sizeof(_type)); \
+            if(output != NULL) { \
+                ra->count++; \
+                ra->sorted = false; \
+                if(ra->index != NULL) ra_index_insert(ra, ra->count - 1); \
+            } \
+            return output; \
+        }
+    #define RA_APPEND_TYPE(pair, _type) RA_APPEND_PROMOTED_TYPE(pair, _type, _type)
+    
+    #define RA_APPEND_PNT_TYPE(pair, _type) \
+        if(strcmp(#_type, ra->type.typename) == 0) { \
             _type value = va_arg(args, _type); \
-            ra->count++; \
-            void * allocated_value = aa_alloc(&________________internal_ra_space_for_pointers, value, strlen(value) + 1); \
-            printf("aa_alloc: %s\n", allocated_value); \
-            return aa_alloc(&ra->memory, &allocated_value, -1 * pair.size); \
+            va_end(args); \
+            return ra_append_string(ra, value); \
+        }
+
+    RA_APPEND_TYPE(RA_INT, int);
+    RA_APPEND_PNT_TYPE(RA_STR, char *);
+    //gen 3 "Append types."
+	RA_APPEND_TYPE(RA_FLOAT, double);
+	RA_APPEND_PROMOTED_TYPE(RA_F32, float, double);
+	RA_APPEND_TYPE(RA_VECTOR3, Vector3);
+	RA_APPEND_TYPE(RA_VECTOR2, Vector2);
+	RA_APPEND_TYPE(RA_WECTANGLE, Wectangle);
+	RA_APPEND_TYPE(RA_WECPAIR, WecPair);
+
+    va_end(args);
+    #ifndef RA_SILENT
+    printf("ra_append: Append failed!\n");
+    #endif
+    return NULL; // no overflow-esque checking here because in reality, if this somehow fails, aa_alloc will probably fail...
+}
+
+void * ra_append_n(r_array * ra, const void * src, size_t n) {
+    if(n == 0) return ra->memory.position;
+
+    if(ra->type.size < 0) {
+        // strings have to be copied one at a time, but at least reserve the pointers once, and make sure they all fit before copying any
+        size_t bytes = n * (size_t) abs(ra->type.size);
+        aa_grow_for(&ra->memory, bytes);
+
+        size_t left = ra->memory.capacity - (size_t) (ra->memory.position - ra->memory.root);
+        if(left < bytes) {
+            #ifndef RA_NO_CRASH_ON_OVERFLOW
+                // this print is not silenceable because it crashes, like aa_alloc()'s
+                printf("ra_append_n: Attempted to append %zu strings (%zu bytes) to ra <%p>, but there were %zu bytes of space left!\n", n, bytes, ra, left);
+                exit(80085);
+            #else
+                #ifndef RA_SILENT
+                printf("ra_append_n: (RA_NO_CRASH_ON_OVERFLOW) Attempted to append %zu strings (%zu bytes) to ra <%p>, but there were %zu bytes of space left!\n", n, bytes, ra, left);
+                #endif
+                return NULL;
+            #endif
+        }
+
+        void * output = NULL;
+        for(size_t i = 0; i < n; i++) {
+            void * appended = ra_append_string(ra, ((char * const *) src)[i]);
+            if(appended == NULL) return NULL;
+            if(output == NULL) output = appended;
+        }
+        return output;
+    }
+
+    void * output = aa_alloc(&ra->memory, (void *) src, n * (size_t) ra->type.size);
+    if(output == NULL) return NULL;
+
+    ra->count += n;
+    ra->sorted = false;
+    if(ra->index != NULL) {
+        for(size_t i = ra->count - n; i < ra->count; i++) ra_index_insert(ra, i);
+    }
+    return output;
+}
+
+void * ra_append_n_concurrent(r_array * ra, const void * src, size_t n) {
+    if(ra->type.size < 0 || ra->index != NULL) {
+        #ifndef RA_SILENT
+        printf("ra_append_concurrent: ra <%p> (%s) is a string array or has an index, which can't be appended to concurrently!\n", ra, ra->type.typename);
+        #endif
+        return NULL;
+    }
+    #ifdef RA_INTERNAL_NO_ATOMICS
+    return aa_alloc_concurrent(&ra->memory, src, 0); // only to say why it refuses
+    #else
+    if(n == 0) return ra_internal_atomic_load_pointer(&ra->memory.position);
+
+    void * output = aa_alloc_concurrent(&ra->memory, src, n * (size_t) ra->type.size);
+    if(output == NULL) return NULL;
+
+    // release, so whoever sees the new count after joining also sees the element
+    ra_internal_atomic_add_size(&ra->count, n);
+    ra_internal_atomic_store_bool(&ra->sorted, false);
+    return output;
+    #endif
+}
+
+void * ra_append_concurrent(r_array * ra, const void * value) {
+    return ra_append_n_concurrent(ra, value, 1);
+}
+
+void * ra_extend(r_array * dst, r_array * src) {
+    if(strcmp(dst->type.typename, src->type.typename) != 0) {
+        #ifndef RA_SILENT
+        printf("ra_extend: Tried to extend ra <%p> (%s) with ra <%p> (%s), but their types don't match!\n", dst, dst->type.typename, src, src->type.typename);
+        #endif
+        return NULL;
+    }
+
+    size_t n = src->count;
+    // grow before taking src's pointer, in case src is dst and growing moves it
+    aa_grow_for(&dst->memory, n * (size_t) abs(dst->type.size));
+
+    return ra_append_n(dst, src->memory.root, n);
+}
+
+void * ra_append_string(r_array * ra, const char * value) {
+    // do not init memory unless it's needed
+    if(ra->strings == NULL) {
+        ra->strings = ra_strpool_create(RA_DEFAULT_STRING_CHUNK, false);
+        ra->owns_strings = true;
+        if(ra->strings == NULL) return NULL;
+    }
+
+    char * allocated_value = ra_strpool_add(ra->strings, value);
+    if(allocated_value == NULL) return NULL;
+
+    void * output = aa_alloc(&ra->memory, &allocated_value, -1 * ra->type.size);
+    if(output == NULL) return NULL;
+
+    ra->count++;
+    ra->sorted = false;
+    if(ra->index != NULL) ra_index_insert(ra, ra->count - 1);
+    return output;
+}
+
+ra_strpool * ra_strpool_create(size_t chunk_size, bool interning) {
+    ra_strpool * pool = calloc(1, sizeof(ra_strpool));
+    if(pool == NULL) return NULL;
+
+    pool->chunk_size = chunk_size;
+    pool->interning = interning;
+    return pool;
+}
+
+void ra_strpool_destroy(ra_strpool * pool) {
+    ra_strchunk * chunk = pool->chunks;
+    while(chunk != NULL) {
+        ra_strchunk * next = chunk->next;
+        aa_destroy(chunk->memory);
+        free(chunk);
+        chunk = next;
+    }
+
+    free(pool->interned);
+    free(pool);
+}
+
+// the interned-string table slot for `value`: either the slot holding an equal string, or the empty one where it would go
+size_t ra_internal_strpool_probe(ra_strpool * pool, const char * value) {
+    size_t mask = pool->interned_capacity - 1;
+    size_t i = ra_internal_hash_bytes((const unsigned char *) value, strlen(value)) & mask;
+
+    while(pool->interned[i] != NULL && strcmp(pool->interned[i], value) != 0) i = (i + 1) & mask;
+    return i;
+}
+
+char * ra_strpool_find(ra_strpool * pool, const char * value) {
+    if(pool->interned_count == 0) return NULL;
+    return pool->interned[ra_internal_strpool_probe(pool, value)];
+}
+
+char * ra_strpool_add(ra_strpool * pool, const char * value) {
+    if(pool->interning) {
+        // keep the load factor at or under 1/2
+        if((pool->interned_count + 1) * 2 > pool->interned_capacity) {
+            size_t old_capacity = pool->interned_capacity;
+            char ** old_interned = pool->interned;
+
+            size_t capacity = (old_capacity == 0) ? 64 : old_capacity * 2;
+            char ** interned = calloc(capacity, sizeof(char *));
+            if(interned == NULL) return NULL;
+
+            pool->interned = interned;
+            pool->interned_capacity = capacity;
+            for(size_t i = 0; i < old_capacity; i++) {
+                if(old_interned[i] != NULL) pool->interned[ra_internal_strpool_probe(pool, old_interned[i])] = old_interned[i];
+            }
+            free(old_interned);
+        }
+
+        size_t slot = ra_internal_strpool_probe(pool, value);
+        if(pool->interned[slot] != NULL) return pool->interned[slot];
+    }
+
+    size_t size = strlen(value) + 1;
+
+    if(pool->chunks == NULL || (pool->chunks->memory.capacity - (pool->chunks->memory.position - pool->chunks->memory.root)) < size) {
+        ra_strchunk * chunk = malloc(sizeof(ra_strchunk));
+        if(chunk == NULL) return NULL;
+
+        chunk->memory = aa_create_unzeroed((size > pool->chunk_size) ? size : pool->chunk_size);
+        if(chunk->memory.root == NULL) {
+            free(chunk);
+            return NULL;
+        }
+        chunk->next = pool->chunks;
+        pool->chunks = chunk;
+    }
+
+    char * output = aa_alloc(&pool->chunks->memory, (void *) value, size);
+
+    if(pool->interning) {
+        pool->interned[ra_internal_strpool_probe(pool, value)] = output;
+        pool->interned_count++;
+    }
+
+    return output;
+}
+
+void ra_set_string_pool(r_array * ra, ra_strpool * pool, bool take_ownership) {
+    if(ra->owns_strings && ra->strings != NULL && ra->strings != pool) ra_strpool_destroy(ra->strings);
+    ra->strings = pool;
+    ra->owns_strings = take_ownership;
+}
+
+void * ra_get(r_array * ra, int idx) {
+    #ifndef RA_NO_CRASH_ON_OVERFLOW
+    if((idx >= (int) ra->count) || (idx < (-1 * (int) ra->count))) {
+        // this print is not silenceable because it crashes. maybe this will be revised in future.
+        printf("ra_get: Attempted to access element %d (%d) of ra <%p>, which only contains %zu elements.\n", idx, (idx < 0) ? (int) ra->count + idx : idx, ra, ra->count);
+        exit(80085);
+    }
+    #else
+    if((idx >= (int) ra->count) || (idx < (-1 * (int) ra->count))) {
+        #ifndef RA_SILENT
+        printf("ra_get: (RA_NO_CRASH_ON_OVERFLOW) Overflow access attempted at element %d (%d) of ra <%p>, which only has %zu elements.\n NULL was returned; you might still get a segfault.\n", idx, (idx < 0) ? (int) ra->count + idx : idx, ra, ra->count);
+        #endif
+        return NULL;
+    }
+    #endif
+
+    return ra_get_unsafe(ra, idx);
+}
+
+void * ra_get_unsafe(r_array * ra, int idx) {
+    if(idx >= 0) return (ra->memory.root + (idx * abs(ra->type.size)));
+    else return (ra->memory.root + (ra->count + idx) * abs(ra->type.size));
+}
+
+void * ra_pop(r_array * ra) {
+    if(ra->count == 0) {
+        #ifndef RA_NO_CRASH_ON_OVERFLOW
+            printf("ra_pop: Tried to pop value of ra <%p>, but this array is empty!\n", ra);
+            exit(80085);
+        #else
+            #ifndef RA_SILENT
+            printf("ra_pop: (RA_NO_CRASH_ON_OVERFLOW) Tried to pop value of ra <%p>, but this array is empty!\nNULL was returned; you might still get a segfault.\n", ra);
+            #endif
+            return NULL;
+        #endif
+    }
+
+    void * output = ra_get(ra, -1); 
+    if(ra->index != NULL) ra_index_remove(ra, ra->count - 1);
+    ra->count--;
+    ra->memory.position -= abs(ra->type.size);
+    return output;
+}
+
+void * ra_pop_at(r_array * ra, int idx) {
+    if(ra->count == 0) {
+        #ifndef RA_NO_CRASH_ON_OVERFLOW
+            printf("ra_pop_at: Tried to pop value of ra <%p> at index %d, but this array is empty!\n", ra, idx);
+            exit(80085);
+        #else
+            #ifndef RA_SILENT
+            printf("ra_pop_at: (RA_NO_CRASH_ON_OVERFLOW) Tried to pop value of ra <%p> at index %d, but this array is empty!\nNULL was returned; you might still get a segfault.\n", ra, idx);
+            #endif
+            return NULL;
+        #endif
+    }
+
+    unsigned int actual_idx = (idx >= 0) ? idx : (ra->count + idx);
+
+    if(actual_idx >= ra->count) {
+        #ifndef RA_NO_CRASH_ON_OVERFLOW
+            printf("ra_pop_at: Tried to pop value of ra <%p> at index %d (%zu), but this array only has %zu elements!\n", ra, idx, actual_idx, ra->count);
+            exit(80085);
+        #else
+            #ifndef RA_SILENT
+            printf("ra_pop_at: Tried to pop value of ra <%p> at index %d (%zu), but this array only has %zu elements!\nNULL was returned; you might still get a segfault.\n", ra, idx, actual_idx, ra->count);
+            #endif
+            return NULL;
+        #endif
+    }
+
+    size_t size = abs(ra->type.size);
+    void * at = ra->memory.root + (actual_idx * size);
+    void * last = ra->memory.root + ((ra->count - 1) * size);
+
+    // keep the popped value around just past the end, like ra_pop() does
+    unsigned char popped[size];
+    memcpy(popped, at, size);
+    memmove(at, at + size, (ra->count - actual_idx - 1) * size);
+    memcpy(last, popped, size);
+
+    ra->count--;
+    ra->memory.position -= size;
+    if(ra->index != NULL) ra_index_rebuild(ra); // every index past actual_idx moved, so there's no cheaper fix-up
+    return last;
+}
+
+void * ra_swap_remove(r_array * ra, int idx) {
+    void * at = ra_get(ra, idx);
+    if(at == NULL) return NULL;
+
+    size_t size = abs(ra->type.size);
+    void * last = ra->memory.root + ((ra->count - 1) * size);
+
+    if(at != last) {
+        unsigned char removed[size];
+        memcpy(removed, at, size);
+        memcpy(at, last, size);
+        memcpy(last, removed, size);
+    }
+
+    ra->count--;
+    ra->memory.position -= size;
+    if(at != last) ra->sorted = false;
+    if(ra->index != NULL) ra_index_rebuild(ra); // the moved element may become the first occurrence of its value
+    return last;
+}
+
+size_t ra_remove_range(r_array * ra, int start_idx, int end_idx) {
+    void * start = ra_get(ra, start_idx);
+    void * end = ra_get(ra, end_idx);
+    if(start == NULL || end == NULL || end < start) return 0;
+
+    size_t size = abs(ra->type.size);
+    void * rest = end + size;
+    size_t removed = (rest - start) / size;
+
+    memmove(start, rest, ra->memory.position - rest);
+    ra->count -= removed;
+    ra->memory.position -= removed * size;
+    if(ra->index != NULL) ra_index_rebuild(ra);
+    return removed;
+}
+
+size_t ra_remove_if(r_array * ra, bool (* pred)(const void * element, void * ctx), void * ctx) {
+    size_t size = abs(ra->type.size);
+    void * kept = ra->memory.root;
+    size_t kept_count = 0;
+
+    for(void * element = ra->memory.root; element < ra->memory.root + ra->count * size; element += size) {
+        if(pred(element, ctx)) continue;
+        if(kept != element) memcpy(kept, element, size);
+        kept += size;
+        kept_count++;
+    }
+
+    return ra_truncate(ra, kept_count);
+}
+
+size_t ra_truncate(r_array * ra, size_t count) {
+    if(count >= ra->count) return 0;
+
+    size_t removed = ra->count - count;
+    ra->count = count;
+    ra->memory.position = ra->memory.root + count * abs(ra->type.size);
+    if(ra->index != NULL) ra_index_rebuild(ra);
+    return removed;
+}
+
+r_array ra_slice(r_array * ra, int start_idx, int end_idx) {
+    unsigned int actual_start = (start_idx >= 0) ? start_idx : (ra->count + start_idx);
+    unsigned int actual_end = (end_idx >= 0) ? end_idx : (ra->count + end_idx);
+
+    if(actual_start >= actual_end) {
+        printf("ra_slice: Attempted to slice array <%p> from %d (%zu) to %d (%zu), which is not allowed.\nThe array passed was returned.\n", ra, start_idx, actual_start, end_idx, actual_end);
+        return *ra;
+    }
+
+    return (r_array) { .count = actual_end - actual_start + 1, 
+                       .memory = (aa_arena) { .root = ra->memory.root + (abs(ra->type.size) * actual_start), 
+                                              .position = ra->memory.root + (abs(ra->type.size) * (actual_end + 1)), 
+                                              .capacity = abs(ra->type.size) * (actual_end - actual_start + 1) }, 
+                       .type = ra->type,
+                       .strings = ra->strings,
+                       .owns_strings = false,
+                       .sorted = ra->sorted };
+}
+
+r_array ra_copy(r_array * ra) {
+    r_array output = { .count = ra->count, .type = ra->type, .memory = (aa_arena) { 0 } };
+
+    if(ra->type.size < 0) {
+        // the copy gets its own strings, so it doesn't depend on `ra`'s pool staying alive
+        output.count = 0;
+        output.memory = aa_create_unzeroed(ra->memory.capacity);
+        output.memory.growth = ra->memory.growth;
+        if(ra->strings != NULL) ra_set_string_pool(&output, ra_strpool_create(ra->strings->chunk_size, ra->strings->interning), true);
+        ra_append_n(&output, ra->memory.root, ra->count);
+        output.sorted = ra->sorted;
+        return output;
+    }
+
+    size_t live_bytes = ra->count * (size_t) abs(ra->type.size);
+
+    output.memory = aa_create_unzeroed(ra->memory.capacity); // everything past live_bytes is unreachable until it is appended over
+    output.memory.growth = ra->memory.growth;
+    output.memory.position += live_bytes;
+    output.sorted = ra->sorted;
+    memcpy(output.memory.root, ra->memory.root, live_bytes);
+
+    return output;
+}
+
+//----------------------------
+// sorting
+
+// radix keys are the raw bits of an int or double
+unsigned long long ra_internal_radix_load(const unsigned char * element, size_t size) {
+    if(size == sizeof(unsigned int)) {
+        unsigned int key;
+        memcpy(&key, element, sizeof(key));
+        return key;
+    }
+    unsigned long long key;
+    memcpy(&key, element, sizeof(key));
+    return key;
+}
+
+void ra_internal_radix_store(unsigned char * element, size_t size, unsigned long long key) {
+    if(size == sizeof(unsigned int)) {
+        unsigned int narrow = (unsigned int) key;
+        memcpy(element, &narrow, sizeof(narrow));
+    } else {
+        memcpy(element, &key, sizeof(key));
+    }
+}
+
+// LSD radix sort, a byte per pass, for int (`size == sizeof(int)`) and double (`floating`) keys. Returns false (and leaves `data` alone) for small arrays, or if the scratch buffer can't be allocated.
+bool ra_internal_radix_sort(void * data, size_t count, size_t size, bool floating) {
+    if(count < 256) return false;
+
+    unsigned char * scratch = malloc(count * size);
+    if(scratch == NULL) return false;
+
+    unsigned long long sign = 1ULL << (size * 8 - 1);
+
+    // map the keys to unsigned ints that sort the same way: flip the sign bit, and for negative doubles, every other bit too
+    size_t histograms[8][256] = { 0 };
+    for(unsigned char * p = data; p < (unsigned char *) data + count * size; p += size) {
+        unsigned long long key = ra_internal_radix_load(p, size);
+        key = (floating && (key & sign)) ? ~key : (key ^ sign);
+        ra_internal_radix_store(p, size, key);
+        for(size_t b = 0; b < size; b++) histograms[b][(key >> (8 * b)) & 0xff]++;
+    }
+
+    unsigned char * src = data;
+    unsigned char * dst = scratch;
+    for(size_t b = 0; b < size; b++) {
+        // a byte that's the same in every key doesn't need a pass
+        if(histograms[b][(ra_internal_radix_load(src, size) >> (8 * b)) & 0xff] == count) continue;
+
+        size_t offsets[256];
+        size_t total = 0;
+        for(int d = 0; d < 256; d++) {
+            offsets[d] = total;
+            total += histograms[b][d];
+        }
+
+        for(unsigned char * p = src; p < src + count * size; p += size) {
+            memcpy(dst + size * offsets[(ra_internal_radix_load(p, size) >> (8 * b)) & 0xff]++, p, size);
+        }
+
+        unsigned char * swap = src;
+        src = dst;
+        dst = swap;
+    }
+
+    if(src != data) memcpy(data, src, count * size);
+    free(scratch);
+
+    for(unsigned char * p = data; p < (unsigned char *) data + count * size; p += size) {
+        unsigned long long key = ra_internal_radix_load(p, size);
+        key = (floating && !(key & sign)) ? ~key : (key ^ sign);
+        ra_internal_radix_store(p, size, key);
+    }
+
+    return true;
+}
+
+RA_DEFINE_SORT(RA_INT, int, int, RA_LESS_PRIMITIVE, RA_RADIX_INTS);
+RA_DEFINE_SORT(RA_STR, char *, str, RA_LESS_STR, RA_RADIX_NONE);
+//gen 7 "Sorting."
+RA_DEFINE_SORT(RA_FLOAT, double, double, RA_LESS_PRIMITIVE, RA_RADIX_DOUBLES);
+RA_DEFINE_SORT(RA_F32, float, float, RA_LESS_PRIMITIVE, RA_RADIX_NONE);
+RA_DEFINE_SORT(RA_VECTOR3, Vector3, Vector3, RA_LESS_XYZ, RA_RADIX_NONE);
+RA_DEFINE_SORT(RA_VECTOR2, Vector2, Vector2, RA_LESS_XY, RA_RADIX_NONE);
+RA_DEFINE_SORT(RA_WECPAIR, WecPair, WecPair, WecPairLess, RA_RADIX_NONE);
+
+typedef enum { RA_ORDERED_SORT, RA_ORDERED_LOWER_BOUND, RA_ORDERED_BSEARCH, RA_ORDERED_MEMBER } ra_ordered_op;
+
+void ra_internal_mark_sorted(r_array * ra) {
+    ra->sorted = true;
+    if(ra->index != NULL) ra_index_rebuild(ra);
+}
+
+// sort or search `ra` with its type's ordering (`args` holds the value, or is `NULL` for sorting); returns -2 if the type has none, or for RA_ORDERED_MEMBER, if the ordering doesn't agree with the type's equality
+long long ra_internal_vordered(r_array * ra, va_list * args, ra_ordered_op op) {
+    #define RA_ORDERED_PROMOTED_TYPE(pair, _type, name, less, exact, _promoted) \
+        if(strcmp(#_type, ra->type.typename) == 0) { \
+            _type * data = (_type *) ra->memory.root; \
+            if(op == RA_ORDERED_SORT) { \
+                ra_sort_data_##name(data, ra->count); \
+                ra_internal_mark_sorted(ra); \
+                return 0; \
+            } \
+            if(op == RA_ORDERED_MEMBER && !(exact)) return -2; \
+            _type value = va_arg(*args, _promoted); \
+            size_t idx = ra_lower_bound_data_##name(data, ra->count, value); \
+            if(op == RA_ORDERED_LOWER_BOUND) return idx; \
+            return (idx < ra->count && !less(value, data[idx])) ? (long long) idx : -1; \
+        }
+    #define RA_ORDERED_TYPE(pair, _type, name, less, exact) RA_ORDERED_PROMOTED_TYPE(pair, _type, name, less, exact, _type)
+
+    RA_ORDERED_TYPE(RA_INT, int, int, RA_LESS_PRIMITIVE, true);
+    RA_ORDERED_TYPE(RA_STR, char *, str, RA_LESS_STR, true);
+    //gen 8 "Orderings."
+	RA_ORDERED_TYPE(RA_FLOAT, double, double, RA_LESS_PRIMITIVE, true);
+	RA_ORDERED_PROMOTED_TYPE(RA_F32, float, float, RA_LESS_PRIMITIVE, true, double);
+	RA_ORDERED_TYPE(RA_VECTOR3, Vector3, Vector3, RA_LESS_XYZ, false);
+	RA_ORDERED_TYPE(RA_VECTOR2, Vector2, Vector2, RA_LESS_XY, false);
+	RA_ORDERED_TYPE(RA_WECPAIR, WecPair, WecPair, WecPairLess, false);
+
+    return -2;
+}
+
+void ra_sort(r_array * ra) {
+    if(ra_internal_vordered(ra, NULL, RA_ORDERED_SORT) == -2) {
+        #ifndef RA_SILENT
+        printf("ra_sort: Tried to sort ra <%p>, but type %s has no ordering!\n", ra, ra->type.typename);
+        #endif
+    }
+}
+
+size_t ra_lower_bound(r_array * ra, ...) {
+    va_list args;
+    va_start(args, ra);
+    long long output = ra_internal_vordered(ra, &args, RA_ORDERED_LOWER_BOUND);
+    va_end(args);
+
+    if(output == -2) {
+        #ifndef RA_SILENT
+        printf("ra_lower_bound: Tried to search ra <%p>, but type %s has no ordering!\n", ra, ra->type.typename);
+        #endif
+        return ra->count;
+    }
+    return (size_t) output;
+}
+
+int ra_bsearch(r_array * ra, ...) {
+    #ifndef RA_SILENT
+    if(!ra->sorted) printf("ra_bsearch: ra <%p> isn't marked sorted; the result is only right if it's in order anyway.\n", ra);
+    #endif
+
+    va_list args;
+    va_start(args, ra);
+    long long output = ra_internal_vordered(ra, &args, RA_ORDERED_BSEARCH);
+    va_end(args);
+
+    if(output == -2) {
+        #ifndef RA_SILENT
+        printf("ra_bsearch: Tried to search ra <%p>, but type %s has no ordering!\n", ra, ra->type.typename);
+        #endif
+        return -1;
+    }
+    return (int) output;
+}
+
+//----------------------------
+// search kernels
+
+#if defined(RA_SIMD_AVX2)
+    #define RA_SIMD_LANES 8
+    typedef __m256 ra_internal_vf;
+    #define RA_VF_LOAD(p) _mm256_loadu_ps(p)
+    #define RA_VF_STORE(p, v) _mm256_storeu_ps((p), (v))
+    #define RA_VF_ZERO() _mm256_setzero_ps()
+    #define RA_VF_MIN(a, b) _mm256_min_ps((a), (b))
+    #define RA_VF_MAX(a, b) _mm256_max_ps((a), (b))
+    #define RA_VF_ADD(a, b) _mm256_add_ps((a), (b))
+    #define RA_VF_SUB(a, b) _mm256_sub_ps((a), (b))
+    #define RA_VF_MUL(a, b) _mm256_mul_ps((a), (b))
+    #define RA_VF_SET1(x) _mm256_set1_ps(x)
+    #define RA_VF_ABS(a) _mm256_andnot_ps(_mm256_set1_ps(-0.0f), (a))
+    #define RA_VF_LT_MASK(a, b) ((unsigned) _mm256_movemask_ps(_mm256_cmp_ps((a), (b), _CMP_LT_OQ))) // a bit per lane
+#elif defined(RA_SIMD_SSE2)
+    #define RA_SIMD_LANES 4
+    typedef __m128 ra_internal_vf;
+    #define RA_VF_LOAD(p) _mm_loadu_ps(p)
+    #define RA_VF_STORE(p, v) _mm_storeu_ps((p), (v))
+    #define RA_VF_ZERO() _mm_setzero_ps()
+    #define RA_VF_MIN(a, b) _mm_min_ps((a), (b))
+    #define RA_VF_MAX(a, b) _mm_max_ps((a), (b))
+    #define RA_VF_ADD(a, b) _mm_add_ps((a), (b))
+    #define RA_VF_SUB(a, b) _mm_sub_ps((a), (b))
+    #define RA_VF_MUL(a, b) _mm_mul_ps((a), (b))
+    #define RA_VF_SET1(x) _mm_set1_ps(x)
+    #define RA_VF_ABS(a) _mm_andnot_ps(_mm_set1_ps(-0.0f), (a))
+    #define RA_VF_LT_MASK(a, b) ((unsigned) _mm_movemask_ps(_mm_cmplt_ps((a), (b)))) // a bit per lane
+#endif
+
+// `mask` must not be 0
+int ra_internal_lowest_bit(unsigned long long mask) {
+    #if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(mask);
+    #elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long idx;
+    _BitScanForward64(&idx, mask);
+    return (int) idx;
+    #else
+    int idx = 0;
+    while((mask & 1) == 0) { mask >>= 1; idx++; }
+    return idx;
+    #endif
+}
+
+int ra_internal_bit_count(unsigned long long mask) {
+    #if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(mask);
+    #else
+    int output = 0;
+    for(; mask != 0; mask &= mask - 1) output++;
+    return output;
+    #endif
+}
+
+// raymath's `FloatEquals()`, without needing libm
+bool ra_internal_float_equals(float a, float b) {
+    float diff = (a > b) ? a - b : b - a;
+    float scale = 1.0f;
+    if(a > scale) scale = a;
+    if(-a > scale) scale = -a;
+    if(b > scale) scale = b;
+    if(-b > scale) scale = -b;
+    return diff <= RA_FLOAT_EPSILON * scale;
+}
+
+#ifdef RA_SIMD_LANES
+// a bit per lane, set where `FloatEquals(a, b)`
+static inline unsigned ra_internal_vf_equals_mask(ra_internal_vf a, ra_internal_vf b) {
+    #if defined(RA_SIMD_AVX2)
+    __m256 sign = _mm256_set1_ps(-0.0f);
+    __m256 diff = _mm256_andnot_ps(sign, _mm256_sub_ps(a, b));
+    __m256 scale = _mm256_max_ps(_mm256_set1_ps(1.0f), _mm256_max_ps(_mm256_andnot_ps(sign, a), _mm256_andnot_ps(sign, b)));
+    return (unsigned) _mm256_movemask_ps(_mm256_cmp_ps(diff, _mm256_mul_ps(_mm256_set1_ps(RA_FLOAT_EPSILON), scale), _CMP_LE_OQ));
+    #else
+    __m128 sign = _mm_set1_ps(-0.0f);
+    __m128 diff = _mm_andnot_ps(sign, _mm_sub_ps(a, b));
+    __m128 scale = _mm_max_ps(_mm_set1_ps(1.0f), _mm_max_ps(_mm_andnot_ps(sign, a), _mm_andnot_ps(sign, b)));
+    return (unsigned) _mm_movemask_ps(_mm_cmple_ps(diff, _mm_mul_ps(_mm_set1_ps(RA_FLOAT_EPSILON), scale)));
+    #endif
+}
+
+// RA_SIMD_LANES tuples of `components` floats take up exactly `components` vectors, and lane l of vector k always holds component (k * RA_SIMD_LANES + l) % components.
+// `needles` is the searched-for tuple laid out that way; `firsts` has the bit of every tuple's first lane set. Returns those bits for the tuples that match.
+static inline unsigned long long ra_internal_floats_match(const float * block, int components, const ra_internal_vf * needles, unsigned long long firsts) {
+    unsigned long long lanes = 0;
+    for(int k = 0; k < components; k++) {
+        lanes |= (unsigned long long) ra_internal_vf_equals_mask(RA_VF_LOAD(block + k * RA_SIMD_LANES), needles[k]) << (k * RA_SIMD_LANES);
+    }
+
+    unsigned long long matches = lanes;
+    for(int t = 1; t < components; t++) matches &= (lanes >> t);
+    return matches & firsts;
+}
+
+void ra_internal_floats_needles(int components, const float * value, ra_internal_vf * needles, unsigned long long * firsts) {
+    float pattern[8 * RA_SIMD_LANES];
+    for(int j = 0; j < components * RA_SIMD_LANES; j++) pattern[j] = value[j % components];
+    for(int k = 0; k < components; k++) needles[k] = RA_VF_LOAD(pattern + k * RA_SIMD_LANES);
+
+    *firsts = 0;
+    for(int j = 0; j < RA_SIMD_LANES; j++) *firsts |= (1ULL << (j * components));
+}
+
+// the vectorized part of ra_find_floats() and ra_count_floats(); returns the index to continue from with plain C
+static inline size_t ra_internal_scan_floats(const float * data, size_t count, int components, const float * value, bool counting, long long * result) {
+    ra_internal_vf needles[8];
+    unsigned long long firsts;
+    ra_internal_floats_needles(components, value, needles, &firsts);
+
+    size_t i = 0;
+    for(; i + RA_SIMD_LANES <= count; i += RA_SIMD_LANES) {
+        unsigned long long matches = ra_internal_floats_match(data + i * components, components, needles, firsts);
+        if(matches == 0) continue;
+        if(!counting) {
+            *result = i + ra_internal_lowest_bit(matches) / components;
+            return count;
+        }
+        *result += ra_internal_bit_count(matches);
+    }
+    return i;
+}
+
+#endif
+
+int ra_find_ints(const int * data, size_t count, int value) {
+    size_t i = 0;
+
+    #if defined(RA_SIMD_AVX2)
+    __m256i needle = _mm256_set1_epi32(value);
+    for(; i + 32 <= count; i += 32) {
+        __m256i e0 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *) (data + i)), needle);
+        __m256i e1 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *) (data + i + 8)), needle);
+        __m256i e2 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *) (data + i + 16)), needle);
+        __m256i e3 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *) (data + i + 24)), needle);
+        __m256i any = _mm256_or_si256(_mm256_or_si256(e0, e1), _mm256_or_si256(e2, e3));
+        if(_mm256_testz_si256(any, any)) continue;
+
+        unsigned long long mask = (unsigned long long) (unsigned) _mm256_movemask_ps(_mm256_castsi256_ps(e0))
+                                | ((unsigned long long) (unsigned) _mm256_movemask_ps(_mm256_castsi256_ps(e1)) << 8)
+                                | ((unsigned long long) (unsigned) _mm256_movemask_ps(_mm256_castsi256_ps(e2)) << 16)
+                                | ((unsigned long long) (unsigned) _mm256_movemask_ps(_mm256_castsi256_ps(e3)) << 24);
+        return (int) (i + ra_internal_lowest_bit(mask));
+    }
+    #elif defined(RA_SIMD_SSE2)
+    __m128i needle = _mm_set1_epi32(value);
+    for(; i + 16 <= count; i += 16) {
+        __m128i e0 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *) (data + i)), needle);
+        __m128i e1 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *) (data + i + 4)), needle);
+        __m128i e2 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *) (data + i + 8)), needle);
+        __m128i e3 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *) (data + i + 12)), needle);
+        __m128i any = _mm_or_si128(_mm_or_si128(e0, e1), _mm_or_si128(e2, e3));
+        if(_mm_movemask_epi8(any) == 0) continue;
+
+        unsigned long long mask = (unsigned long long) (unsigned) _mm_movemask_ps(_mm_castsi128_ps(e0))
+                                | ((unsigned long long) (unsigned) _mm_movemask_ps(_mm_castsi128_ps(e1)) << 4)
+                                | ((unsigned long long) (unsigned) _mm_movemask_ps(_mm_castsi128_ps(e2)) << 8)
+                                | ((unsigned long long) (unsigned) _mm_movemask_ps(_mm_castsi128_ps(e3)) << 12);
+        return (int) (i + ra_internal_lowest_bit(mask));
+    }
+    #endif
+
+    for(; i < count; i++) {
+        if(data[i] == value) return (int) i;
+    }
+    return -1;
+}
+
+size_t ra_count_ints(const int * data, size_t count, int value) {
+    size_t i = 0;
+    size_t output = 0;
+
+    #if defined(RA_SIMD_AVX2) || defined(RA_SIMD_SSE2)
+    // the per-lane counters are 32 bits, so they're flushed before they could overflow
+    while(count - i >= RA_SIMD_LANES) {
+        size_t steps = (count - i) / RA_SIMD_LANES;
+        if(steps > 0x7fffffff) steps = 0x7fffffff;
+
+        unsigned lanes[RA_SIMD_LANES];
+        #if defined(RA_SIMD_AVX2)
+        __m256i needle = _mm256_set1_epi32(value);
+        __m256i counts = _mm256_setzero_si256();
+        for(size_t s = 0; s < steps; s++, i += 8) {
+            counts = _mm256_sub_epi32(counts, _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *) (data + i)), needle));
+        }
+        _mm256_storeu_si256((__m256i *) lanes, counts);
+        #else
+        __m128i needle = _mm_set1_epi32(value);
+        __m128i counts = _mm_setzero_si128();
+        for(size_t s = 0; s < steps; s++, i += 4) {
+            counts = _mm_sub_epi32(counts, _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *) (data + i)), needle));
+        }
+        _mm_storeu_si128((__m128i *) lanes, counts);
+        #endif
+
+        for(int l = 0; l < RA_SIMD_LANES; l++) output += lanes[l];
+    }
+    #endif
+
+    for(; i < count; i++) {
+        if(data[i] == value) output++;
+    }
+    return output;
+}
+
+bool ra_minmax_ints(const int * data, size_t count, int * min, int * max) {
+    if(count == 0) return false;
+
+    size_t i = 0;
+    int lo = data[0];
+    int hi = data[0];
+
+    #if defined(RA_SIMD_AVX2)
+    if(count >= 8) {
+        __m256i vlo = _mm256_loadu_si256((const __m256i *) data);
+        __m256i vhi = vlo;
+        for(i = 8; i + 8 <= count; i += 8) {
+            __m256i v = _mm256_loadu_si256((const __m256i *) (data + i));
+            vlo = _mm256_min_epi32(vlo, v);
+            vhi = _mm256_max_epi32(vhi, v);
+        }
+
+        int lanes_lo[8], lanes_hi[8];
+        _mm256_storeu_si256((__m256i *) lanes_lo, vlo);
+        _mm256_storeu_si256((__m256i *) lanes_hi, vhi);
+        for(int l = 0; l < 8; l++) {
+            if(lanes_lo[l] < lo) lo = lanes_lo[l];
+            if(lanes_hi[l] > hi) hi = lanes_hi[l];
+        }
+    }
+    #elif defined(RA_SIMD_SSE2)
+    if(count >= 4) {
+        // SSE2 has no 32-bit min/max, so select through a compare mask
+        __m128i vlo = _mm_loadu_si128((const __m128i *) data);
+        __m128i vhi = vlo;
+        for(i = 4; i + 4 <= count; i += 4) {
+            __m128i v = _mm_loadu_si128((const __m128i *) (data + i));
+            __m128i below = _mm_cmplt_epi32(v, vlo);
+            __m128i above = _mm_cmpgt_epi32(v, vhi);
+            vlo = _mm_or_si128(_mm_and_si128(below, v), _mm_andnot_si128(below, vlo));
+            vhi = _mm_or_si128(_mm_and_si128(above, v), _mm_andnot_si128(above, vhi));
+        }
+
+        int lanes_lo[4], lanes_hi[4];
+        _mm_storeu_si128((__m128i *) lanes_lo, vlo);
+        _mm_storeu_si128((__m128i *) lanes_hi, vhi);
+        for(int l = 0; l < 4; l++) {
+            if(lanes_lo[l] < lo) lo = lanes_lo[l];
+            if(lanes_hi[l] > hi) hi = lanes_hi[l];
         }
+    }
+    #endif
+
+    for(; i < count; i++) {
+        if(data[i] < lo) lo = data[i];
+        if(data[i] > hi) hi = data[i];
+    }
+
+    *min = lo;
+    *max = hi;
+    return true;
+}
+
+long long ra_sum_ints(const int * data, size_t count) {
+    size_t i = 0;
+    long long output = 0;
+
+    #if defined(RA_SIMD_AVX2)
+    __m256i sums = _mm256_setzero_si256();
+    for(; i + 8 <= count; i += 8) {
+        __m256i v = _mm256_loadu_si256((const __m256i *) (data + i));
+        sums = _mm256_add_epi64(sums, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+        sums = _mm256_add_epi64(sums, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+    }
+
+    long long lanes[4];
+    _mm256_storeu_si256((__m256i *) lanes, sums);
+    output = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    #elif defined(RA_SIMD_SSE2)
+    __m128i sums = _mm_setzero_si128();
+    for(; i + 4 <= count; i += 4) {
+        // sign-extend to 64 bits by interleaving with the sign words
+        __m128i v = _mm_loadu_si128((const __m128i *) (data + i));
+        __m128i sign = _mm_srai_epi32(v, 31);
+        sums = _mm_add_epi64(sums, _mm_unpacklo_epi32(v, sign));
+        sums = _mm_add_epi64(sums, _mm_unpackhi_epi32(v, sign));
+    }
+
+    long long lanes[2];
+    _mm_storeu_si128((__m128i *) lanes, sums);
+    output = lanes[0] + lanes[1];
+    #endif
+
+    for(; i < count; i++) output += data[i];
+    return output;
+}
+
+int ra_find_doubles(const double * data, size_t count, double value) {
+    size_t i = 0;
+
+    #if defined(RA_SIMD_AVX2)
+    __m256d needle = _mm256_set1_pd(value);
+    for(; i + 16 <= count; i += 16) {
+        unsigned long long mask = (unsigned long long) (unsigned) _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(data + i), needle, _CMP_EQ_OQ))
+                                | ((unsigned long long) (unsigned) _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(data + i + 4), needle, _CMP_EQ_OQ)) << 4)
+                                | ((unsigned long long) (unsigned) _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(data + i + 8), needle, _CMP_EQ_OQ)) << 8)
+                                | ((unsigned long long) (unsigned) _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(data + i + 12), needle, _CMP_EQ_OQ)) << 12);
+        if(mask != 0) return (int) (i + ra_internal_lowest_bit(mask));
+    }
+    #elif defined(RA_SIMD_SSE2)
+    __m128d needle = _mm_set1_pd(value);
+    for(; i + 8 <= count; i += 8) {
+        unsigned long long mask = (unsigned long long) (unsigned) _mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(data + i), needle))
+                                | ((unsigned long long) (unsigned) _mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(data + i + 2), needle)) << 2)
+                                | ((unsigned long long) (unsigned) _mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(data + i + 4), needle)) << 4)
+                                | ((unsigned long long) (unsigned) _mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(data + i + 6), needle)) << 6);
+        if(mask != 0) return (int) (i + ra_internal_lowest_bit(mask));
+    }
+    #endif
+
+    for(; i < count; i++) {
+        if(data[i] == value) return (int) i;
+    }
+    return -1;
+}
 
-    RA_APPEND_TYPE(RA_INT, int);
-    RA_APPEND_PNT_TYPE(RA_STR, char *);
-    //gen 3 "Append types."
-	RA_APPEND_TYPE(RA_FLOAT, double);
-	RA_APPEND_TYPE(RA_VECTOR3, Vector3);
-	RA_APPEND_TYPE(RA_VECTOR2, Vector2);
-	RA_APPEND_TYPE(RA_WECTANGLE, Wectangle);
+size_t ra_count_doubles(const double * data, size_t count, double value) {
+    size_t i = 0;
+    size_t output = 0;
 
-    #ifndef RA_SILENT
-    printf("ra_append: Append failed!\n");
+    #if defined(RA_SIMD_AVX2)
+    __m256d needle = _mm256_set1_pd(value);
+    __m256i counts = _mm256_setzero_si256();
+    for(; i + 4 <= count; i += 4) {
+        counts = _mm256_sub_epi64(counts, _mm256_castpd_si256(_mm256_cmp_pd(_mm256_loadu_pd(data + i), needle, _CMP_EQ_OQ)));
+    }
+
+    unsigned long long lanes[4];
+    _mm256_storeu_si256((__m256i *) lanes, counts);
+    output = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    #elif defined(RA_SIMD_SSE2)
+    __m128d needle = _mm_set1_pd(value);
+    __m128i counts = _mm_setzero_si128();
+    for(; i + 2 <= count; i += 2) {
+        counts = _mm_sub_epi64(counts, _mm_castpd_si128(_mm_cmpeq_pd(_mm_loadu_pd(data + i), needle)));
+    }
+
+    unsigned long long lanes[2];
+    _mm_storeu_si128((__m128i *) lanes, counts);
+    output = lanes[0] + lanes[1];
     #endif
-    return NULL; // no overflow-esque checking here because in reality, if this somehow fails, aa_alloc will probably fail...
+
+    for(; i < count; i++) {
+        if(data[i] == value) output++;
+    }
+    return output;
 }
 
-void * ra_get(r_array * ra, int idx) {
-    #ifndef RA_NO_CRASH_ON_OVERFLOW
-    if((idx >= (int) ra->count) || (idx < (-1 * (int) ra->count))) {
-        // this print is not silenceable because it crashes. maybe this will be revised in future.
-        printf("ra_get: Attempted to access element %d (%d) of ra <%p>, which only contains %zu elements.\n", idx, (idx < 0) ? (int) ra->count + idx : idx, ra, ra->count);
-        exit(80085);
+bool ra_minmax_doubles(const double * data, size_t count, double * min, double * max) {
+    if(count == 0) return false;
+
+    size_t i = 0;
+    double lo = data[0];
+    double hi = data[0];
+
+    #if defined(RA_SIMD_AVX2)
+    if(count >= 4) {
+        __m256d vlo = _mm256_loadu_pd(data);
+        __m256d vhi = vlo;
+        for(i = 4; i + 4 <= count; i += 4) {
+            __m256d v = _mm256_loadu_pd(data + i);
+            vlo = _mm256_min_pd(vlo, v);
+            vhi = _mm256_max_pd(vhi, v);
+        }
+
+        double lanes_lo[4], lanes_hi[4];
+        _mm256_storeu_pd(lanes_lo, vlo);
+        _mm256_storeu_pd(lanes_hi, vhi);
+        for(int l = 0; l < 4; l++) {
+            if(lanes_lo[l] < lo) lo = lanes_lo[l];
+            if(lanes_hi[l] > hi) hi = lanes_hi[l];
+        }
     }
-    #else
-    if((idx >= (int) ra->count) || (idx < (-1 * (int) ra->count))) {
-        #ifndef RA_SILENT
-        printf("ra_get: (RA_NO_CRASH_ON_OVERFLOW) Overflow access attempted at element %d (%d) of ra <%p>, which only has %zu elements.\n NULL was returned; you might still get a segfault.\n", idx, (idx < 0) ? (int) ra->count + idx : idx, ra, ra->count);
-        #endif
-        return NULL;
+    #elif defined(RA_SIMD_SSE2)
+    if(count >= 2) {
+        __m128d vlo = _mm_loadu_pd(data);
+        __m128d vhi = vlo;
+        for(i = 2; i + 2 <= count; i += 2) {
+            __m128d v = _mm_loadu_pd(data + i);
+            vlo = _mm_min_pd(vlo, v);
+            vhi = _mm_max_pd(vhi, v);
+        }
+
+        double lanes_lo[2], lanes_hi[2];
+        _mm_storeu_pd(lanes_lo, vlo);
+        _mm_storeu_pd(lanes_hi, vhi);
+        for(int l = 0; l < 2; l++) {
+            if(lanes_lo[l] < lo) lo = lanes_lo[l];
+            if(lanes_hi[l] > hi) hi = lanes_hi[l];
+        }
     }
     #endif
 
-    return ra_get_unsafe(ra, idx);
+    for(; i < count; i++) {
+        if(data[i] < lo) lo = data[i];
+        if(data[i] > hi) hi = data[i];
+    }
+
+    *min = lo;
+    *max = hi;
+    return true;
 }
 
-void * ra_get_unsafe(r_array * ra, int idx) {
-    if(idx >= 0) return (ra->memory.root + (idx * abs(ra->type.size)));
-    else return (ra->memory.root + (ra->count + idx) * abs(ra->type.size));
+double ra_sum_doubles(const double * data, size_t count) {
+    size_t i = 0;
+    double output = 0;
+
+    // two accumulators, so consecutive adds don't wait on each other
+    #if defined(RA_SIMD_AVX2)
+    __m256d sums0 = _mm256_setzero_pd();
+    __m256d sums1 = _mm256_setzero_pd();
+    for(; i + 8 <= count; i += 8) {
+        sums0 = _mm256_add_pd(sums0, _mm256_loadu_pd(data + i));
+        sums1 = _mm256_add_pd(sums1, _mm256_loadu_pd(data + i + 4));
+    }
+
+    double lanes[4];
+    _mm256_storeu_pd(lanes, _mm256_add_pd(sums0, sums1));
+    output = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    #elif defined(RA_SIMD_SSE2)
+    __m128d sums0 = _mm_setzero_pd();
+    __m128d sums1 = _mm_setzero_pd();
+    for(; i + 4 <= count; i += 4) {
+        sums0 = _mm_add_pd(sums0, _mm_loadu_pd(data + i));
+        sums1 = _mm_add_pd(sums1, _mm_loadu_pd(data + i + 2));
+    }
+
+    double lanes[2];
+    _mm_storeu_pd(lanes, _mm_add_pd(sums0, sums1));
+    output = lanes[0] + lanes[1];
+    #endif
+
+    for(; i < count; i++) output += data[i];
+    return output;
 }
 
-void * ra_pop(r_array * ra) {
-    if(ra->count == 0) {
-        #ifndef RA_NO_CRASH_ON_OVERFLOW
-            printf("ra_pop: Tried to pop value of ra <%p>, but this array is empty!\n", ra);
-            exit(80085);
-        #else
-            #ifndef RA_SILENT
-            printf("ra_pop: (RA_NO_CRASH_ON_OVERFLOW) Tried to pop value of ra <%p>, but this array is empty!\nNULL was returned; you might still get a segfault.\n", ra);
-            #endif
-            return NULL;
-        #endif
+int ra_find_floats(const float * data, size_t count, int components, const float * value) {
+    size_t i = 0;
+
+    #ifdef RA_SIMD_LANES
+    // the constant component counts let the compiler unroll the common cases
+    long long found = -1;
+    if(components == 2) i = ra_internal_scan_floats(data, count, 2, value, false, &found);
+    else if(components == 3) i = ra_internal_scan_floats(data, count, 3, value, false, &found);
+    else if(components >= 1 && components <= 8) i = ra_internal_scan_floats(data, count, components, value, false, &found);
+    if(found >= 0) return (int) found;
+    #endif
+
+    for(; i < count; i++) {
+        int c = 0;
+        while(c < components && ra_internal_float_equals(data[i * components + c], value[c])) c++;
+        if(c == components) return (int) i;
     }
+    return -1;
+}
 
-    void * output = ra_get(ra, -1); 
-    ra->count--;
-    ra->memory.position -= ra->type.size;
+size_t ra_count_floats(const float * data, size_t count, int components, const float * value) {
+    size_t i = 0;
+    size_t output = 0;
+
+    #ifdef RA_SIMD_LANES
+    long long found = 0;
+    if(components == 2) i = ra_internal_scan_floats(data, count, 2, value, true, &found);
+    else if(components == 3) i = ra_internal_scan_floats(data, count, 3, value, true, &found);
+    else if(components >= 1 && components <= 8) i = ra_internal_scan_floats(data, count, components, value, true, &found);
+    output = found;
+    #endif
+
+    for(; i < count; i++) {
+        int c = 0;
+        while(c < components && ra_internal_float_equals(data[i * components + c], value[c])) c++;
+        if(c == components) output++;
+    }
     return output;
 }
 
-void * ra_pop_at(r_array * ra, int idx) {
-    if(ra->count == 0) {
-        #ifndef RA_NO_CRASH_ON_OVERFLOW
-            printf("ra_pop_at: Tried to pop value of ra <%p> at index %d, but this array is empty!\n", ra, idx);
-            exit(80085);
-        #else
-            #ifndef RA_SILENT
-            printf("ra_pop_at: (RA_NO_CRASH_ON_OVERFLOW) Tried to pop value of ra <%p> at index %d, but this array is empty!\nNULL was returned; you might still get a segfault.\n", ra, idx);
-            #endif
-            return NULL;
-        #endif
+bool ra_minmax_floats(const float * data, size_t count, int components, float * min, float * max) {
+    if(count == 0) return false;
+
+    size_t i = 0;
+    for(int c = 0; c < components; c++) {
+        min[c] = data[c];
+        max[c] = data[c];
     }
 
-    unsigned int actual_idx = (idx >= 0) ? idx : (ra->count + idx);
+    #ifdef RA_SIMD_LANES
+    if(components <= 8 && count >= RA_SIMD_LANES) {
+        // see ra_internal_floats_match() for the layout
+        ra_internal_vf lo[8], hi[8];
+        for(int k = 0; k < components; k++) {
+            lo[k] = RA_VF_LOAD(data + k * RA_SIMD_LANES);
+            hi[k] = lo[k];
+        }
+        for(i = RA_SIMD_LANES; i + RA_SIMD_LANES <= count; i += RA_SIMD_LANES) {
+            for(int k = 0; k < components; k++) {
+                ra_internal_vf v = RA_VF_LOAD(data + i * components + k * RA_SIMD_LANES);
+                lo[k] = RA_VF_MIN(lo[k], v);
+                hi[k] = RA_VF_MAX(hi[k], v);
+            }
+        }
 
-    if(actual_idx >= ra->count) {
-        #ifndef RA_NO_CRASH_ON_OVERFLOW
-            printf("ra_pop_at: Tried to pop value of ra <%p> at index %d (%zu), but this array only has %zu elements!\n", ra, idx, actual_idx, ra->count);
-            exit(80085);
-        #else
-            #ifndef RA_SILENT
-            printf("ra_pop_at: Tried to pop value of ra <%p> at index %d (%zu), but this array only has %zu elements!\nNULL was returned; you might still get a segfault.\n", ra, idx, actual_idx, ra->count);
-            #endif
-            return NULL;
-        #endif
+        float lanes_lo[8 * RA_SIMD_LANES], lanes_hi[8 * RA_SIMD_LANES];
+        for(int k = 0; k < components; k++) {
+            RA_VF_STORE(lanes_lo + k * RA_SIMD_LANES, lo[k]);
+            RA_VF_STORE(lanes_hi + k * RA_SIMD_LANES, hi[k]);
+        }
+        for(int j = 0; j < components * RA_SIMD_LANES; j++) {
+            if(lanes_lo[j] < min[j % components]) min[j % components] = lanes_lo[j];
+            if(lanes_hi[j] > max[j % components]) max[j % components] = lanes_hi[j];
+        }
+    }
+    #endif
+
+    for(; i < count; i++) {
+        for(int c = 0; c < components; c++) {
+            float v = data[i * components + c];
+            if(v < min[c]) min[c] = v;
+            if(v > max[c]) max[c] = v;
+        }
     }
+    return true;
+}
+
+void ra_sum_floats(const float * data, size_t count, int components, float * sum) {
+    size_t i = 0;
+    for(int c = 0; c < components; c++) sum[c] = 0;
 
-    unsigned char back_buffer[ra->type.size];
-    memcpy(back_buffer, ra->memory.root + (actual_idx * ra->type.size), ra->type.size);
-    unsigned char rest_buffer[(ra->count - actual_idx) + 1];
-    memcpy(rest_buffer, ra->memory.root + ((actual_idx + 1) * ra->type.size), ra->type.size * ((ra->count - actual_idx) - 1));
+    #ifdef RA_SIMD_LANES
+    if(components <= 8) {
+        ra_internal_vf sums[8];
+        for(int k = 0; k < components; k++) sums[k] = RA_VF_ZERO();
+        for(; i + RA_SIMD_LANES <= count; i += RA_SIMD_LANES) {
+            for(int k = 0; k < components; k++) sums[k] = RA_VF_ADD(sums[k], RA_VF_LOAD(data + i * components + k * RA_SIMD_LANES));
+        }
 
-    memcpy(ra->memory.root + (actual_idx * ra->type.size), rest_buffer, ra->type.size * ((ra->count - actual_idx) + 1));
-    memcpy(ra->memory.root + ((ra->count - 1) * ra->type.size), back_buffer, ra->type.size);
+        float lanes[8 * RA_SIMD_LANES];
+        for(int k = 0; k < components; k++) RA_VF_STORE(lanes + k * RA_SIMD_LANES, sums[k]);
+        for(int j = 0; j < components * RA_SIMD_LANES; j++) sum[j % components] += lanes[j];
+    }
+    #endif
 
-    return ra_pop(ra);
+    for(; i < count; i++) {
+        for(int c = 0; c < components; c++) sum[c] += data[i * components + c];
+    }
 }
 
-r_array ra_slice(r_array * ra, int start_idx, int end_idx) {
-    unsigned int actual_start = (start_idx >= 0) ? start_idx : (ra->count + start_idx);
-    unsigned int actual_end = (end_idx >= 0) ? end_idx : (ra->count + end_idx);
+typedef enum { RA_KERNEL_NONE, RA_KERNEL_INTS, RA_KERNEL_DOUBLES, RA_KERNEL_FLOATS } ra_kernel;
 
-    if(actual_start >= actual_end) {
-        printf("ra_slice: Attempted to slice array <%p> from %d (%zu) to %d (%zu), which is not allowed.\nThe array passed was returned.\n", ra, start_idx, actual_start, end_idx, actual_end);
-        return *ra;
+// the types with kernels, and the comparison (as written in the type's registration) the kernel agrees with; keep in sync with find_of() in ra_generator.c, which picks the same kernels for the typed API
+static const struct { const char * typename; const char * comparison; ra_kernel kernel; int components; } ra_internal_kernels[] = {
+    { "int", "RA_EQ_PRIMITIVE", RA_KERNEL_INTS, 1 },
+    { "double", "RA_EQ_PRIMITIVE", RA_KERNEL_DOUBLES, 1 },
+    { "Vector2", "Vector2Equals", RA_KERNEL_FLOATS, 2 },
+    { "Vector3", "Vector3Equals", RA_KERNEL_FLOATS, 3 },
+};
+
+// the kernel for a contiguous view, or RA_KERNEL_NONE; `comparison` is NULL when comparing doesn't matter (min/max, sum)
+ra_kernel ra_internal_kernel_for(ra_view view, const char * comparison, int * components) {
+    if(view.stride != view.size) return RA_KERNEL_NONE;
+
+    for(size_t i = 0; i < sizeof(ra_internal_kernels) / sizeof(ra_internal_kernels[0]); i++) {
+        if(strcmp(view.typename, ra_internal_kernels[i].typename) != 0) continue;
+        if(comparison != NULL && strcmp(comparison, ra_internal_kernels[i].comparison) != 0) return RA_KERNEL_NONE;
+
+        *components = ra_internal_kernels[i].components;
+        return ra_internal_kernels[i].kernel;
     }
+    return RA_KERNEL_NONE;
+}
 
-    return (r_array) { .count = actual_end - actual_start + 1, 
-                       .memory = (aa_arena) { .root = ra->memory.root + (abs(ra->type.size) * actual_start), 
-                                              .position = ra->memory.root + (abs(ra->type.size) * (actual_end + 1)), 
-                                              .capacity = abs(ra->type.size) * (actual_end - actual_start + 1) }, 
-                       .type = ra->type };
+// find (or count) `value` in a view with a kernel, if its type has one; returns false otherwise
+bool ra_internal_scan_kernel(ra_view view, const char * comparison, const void * value, bool counting, long long * result) {
+    int components;
+    switch(ra_internal_kernel_for(view, comparison, &components)) {
+        case RA_KERNEL_INTS: {
+            *result = (counting) ? (long long) ra_count_ints(view.data, view.count, *(const int *) value) : ra_find_ints(view.data, view.count, *(const int *) value);
+            return true;
+        }
+        case RA_KERNEL_DOUBLES: {
+            *result = (counting) ? (long long) ra_count_doubles(view.data, view.count, *(const double *) value) : ra_find_doubles(view.data, view.count, *(const double *) value);
+            return true;
+        }
+        case RA_KERNEL_FLOATS: {
+            *result = (counting) ? (long long) ra_count_floats(view.data, view.count, components, value) : ra_find_floats(view.data, view.count, components, value);
+            return true;
+        }
+        default: return false;
+    }
 }
 
-r_array ra_copy(r_array * ra) {
-    r_array output = { .count = ra->count, .type = ra->type, .memory = (aa_arena) { 0 } };
+bool ra_view_minmax(ra_view view, void * min, void * max) {
+    int components;
+    switch(ra_internal_kernel_for(view, NULL, &components)) {
+        case RA_KERNEL_INTS: return ra_minmax_ints(view.data, view.count, min, max);
+        case RA_KERNEL_DOUBLES: return ra_minmax_doubles(view.data, view.count, min, max);
+        case RA_KERNEL_FLOATS: return ra_minmax_floats(view.data, view.count, components, min, max);
+        default: return false;
+    }
+}
+
+bool ra_view_sum(ra_view view, void * sum) {
+    int components;
+    switch(ra_internal_kernel_for(view, NULL, &components)) {
+        case RA_KERNEL_INTS: *(long long *) sum = ra_sum_ints(view.data, view.count); return true;
+        case RA_KERNEL_DOUBLES: *(double *) sum = ra_sum_doubles(view.data, view.count); return true;
+        case RA_KERNEL_FLOATS: ra_sum_floats(view.data, view.count, components, sum); return true;
+        default: return false;
+    }
+}
+
+ra_view ra_view_of(r_array * ra) {
+    return (ra_view) { .data = ra->memory.root, .count = ra->count, .stride = abs(ra->type.size), .typename = ra->type.typename, .size = ra->type.size };
+}
+
+ra_view ra_view_slice(r_array * ra, int start_idx, int end_idx) {
+    return ra_view_sub(ra_view_of(ra), start_idx, end_idx);
+}
+
+ra_view ra_view_sub(ra_view view, int start_idx, int end_idx) {
+    long long actual_start = (start_idx >= 0) ? start_idx : ((long long) view.count + start_idx);
+    long long actual_end = (end_idx >= 0) ? end_idx : ((long long) view.count + end_idx);
+
+    if(actual_start < 0 || actual_end >= (long long) view.count || actual_start > actual_end) {
+        #ifndef RA_SILENT
+        printf("ra_view_sub: Attempted to view %d (%lld) to %d (%lld) of a view with %zu elements. An empty view was returned.\n", start_idx, actual_start, end_idx, actual_end, view.count);
+        #endif
+        view.count = 0;
+        return view;
+    }
+
+    view.data = (const unsigned char *) view.data + actual_start * view.stride;
+    view.count = actual_end - actual_start + 1;
+    return view;
+}
+
+ra_view ra_view_step(ra_view view, int step) {
+    if(step == 0) {
+        #ifndef RA_SILENT
+        printf("ra_view_step: A step of 0 is not allowed. The view passed was returned.\n");
+        #endif
+        return view;
+    }
+
+    size_t magnitude = (step > 0) ? step : -step;
+    if(step < 0 && view.count > 0) view.data = ra_view_get_unsafe(view, -1);
+
+    view.count = (view.count + magnitude - 1) / magnitude;
+    view.stride *= step;
+    return view;
+}
+
+const void * ra_view_get(ra_view view, int idx) {
+    #ifndef RA_NO_CRASH_ON_OVERFLOW
+    if((idx >= (int) view.count) || (idx < (-1 * (int) view.count))) {
+        printf("ra_view_get: Attempted to access element %d (%d) of a view which only contains %zu elements.\n", idx, (idx < 0) ? (int) view.count + idx : idx, view.count);
+        exit(80085);
+    }
+    #else
+    if((idx >= (int) view.count) || (idx < (-1 * (int) view.count))) {
+        #ifndef RA_SILENT
+        printf("ra_view_get: (RA_NO_CRASH_ON_OVERFLOW) Overflow access attempted at element %d (%d) of a view which only has %zu elements.\n NULL was returned; you might still get a segfault.\n", idx, (idx < 0) ? (int) view.count + idx : idx, view.count);
+        #endif
+        return NULL;
+    }
+    #endif
+
+    return ra_view_get_unsafe(view, idx);
+}
+
+const void * ra_view_get_unsafe(ra_view view, int idx) {
+    long long actual_idx = (idx >= 0) ? idx : ((long long) view.count + idx);
+    return (const unsigned char *) view.data + actual_idx * view.stride;
+}
+
+r_array ra_view_copy(ra_view view, ra_type type_pair) {
+    r_array output = ra_create_cap(type_pair, view.count);
 
-    output.memory = aa_create(ra->memory.capacity);
-    output.memory.position += (ra->type.size * ra->count);
-    memcpy(output.memory.root, ra->memory.root, ra->memory.capacity);
+    if(view.stride == abs(view.size) && view.size > 0) {
+        ra_append_n(&output, view.data, view.count);
+        return output;
+    }
 
+    // strided views (and string views, whose strings need copying anyway) go one element at a time
+    for(size_t i = 0; i < view.count; i++) {
+        const void * element = ra_view_get_unsafe(view, i);
+        if(view.size < 0) ra_append_string(&output, *(const char * const *) element);
+        else ra_append_n(&output, element, 1);
+    }
     return output;
 }
 
 bool ra_member_of(r_array * ra, ...) {
     va_list args;
     va_start(args, ra);
-    void * v = va_arg(args, void *);
+    int output = ra_vmember_at(ra, args);
+    va_end(args);
 
-    return (ra_member_at(ra, v) >= 0);
+    return (output >= 0);
 }
 
 int ra_member_at(r_array * ra, ...) {
-    if(ra->count == 0) return -1;
-
     va_list args;
     va_start(args, ra);
+    int output = ra_vmember_at(ra, args);
+    va_end(args);
 
-    #define RA_MEMBER_AT_TYPE(pair, _type) \
-        if(strcmp(#_type, ra->type.typename) == 0) { \
-            _type value = va_arg(args, _type); \
-            for(size_t i = 0; i < ra->count; i++) { \
-                if(value == *(_type *) ra_get(ra, i)) return i; \
+    return output;
+}
+
+// shared by arrays and views; `ra` is the viewed array if there is one (for its index and string pool), `NULL` otherwise.
+// returns the index of the first match, or the number of matches if `counting`
+long long ra_internal_vmember_at(r_array * ra, ra_view view, va_list args, bool counting) {
+    if(view.count == 0) return (counting) ? 0 : -1;
+    long long found = 0;
+
+    #define RA_MEMBER_AT_PROMOTED_TYPE(pair, _type, _promoted) \
+        if(strcmp(#_type, view.typename) == 0) { \
+            _type value = va_arg(args, _promoted); \
+            if(!counting && ra != NULL && ra->index != NULL) return ra_index_find(ra, &value); \
+            if(ra_internal_scan_kernel(view, "RA_EQ_PRIMITIVE", &value, counting, &found)) return found; \
+            for(size_t i = 0; i < view.count; i++) { \
+                if(value == *(const _type *) ra_view_get_unsafe(view, i)) { \
+                    if(!counting) return i; \
+                    found++; \
+                } \
             } \
+            return (counting) ? found : -1; \
         }
+    #define RA_MEMBER_AT_TYPE(pair, _type) RA_MEMBER_AT_PROMOTED_TYPE(pair, _type, _type)
     
     #define RA_MEMBER_AT_TYPE_CMP(pair, _type, cmp) \
-        if(strcmp(#_type, ra->type.typename) == 0) { \
+        if(strcmp(#_type, view.typename) == 0) { \
             _type value = va_arg(args, _type); \
-            for(size_t i = 0; i < ra->count; i++) { \
-                if(cmp(value, *(_type *) ra_get(ra, i)) == 0) return i; \
+            if(!counting && ra != NULL && ra->index != NULL) return ra_index_find(ra, &value); \
+            if(ra_internal_scan_kernel(view, #cmp, &value, counting, &found)) return found; \
+            for(size_t i = 0; i < view.count; i++) { \
+                if(cmp(value, *(const _type *) ra_view_get_unsafe(view, i))) { \
+                    if(!counting) return i; \
+                    found++; \
+                } \
             } \
+            return (counting) ? found : -1; \
         }
     
+    // with an interning pool, the lookup is one hash probe and the scan is pointer compares
+    #define RA_MEMBER_AT_PNT_TYPE(pair, _type, cmp) \
+        if(strcmp(#_type, view.typename) == 0) { \
+            _type value = va_arg(args, _type); \
+            if(!counting && ra != NULL && ra->index != NULL) return ra_index_find(ra, &value); \
+            if(ra != NULL && ra->strings != NULL && ra->strings->interning) { \
+                _type interned = ra_strpool_find(ra->strings, value); \
+                if(interned == NULL) return (counting) ? 0 : -1; \
+                for(size_t i = 0; i < view.count; i++) { \
+                    if(interned == *(_type const *) ra_view_get_unsafe(view, i)) { \
+                        if(!counting) return i; \
+                        found++; \
+                    } \
+                } \
+                return (counting) ? found : -1; \
+            } \
+            for(size_t i = 0; i < view.count; i++) { \
+                if(cmp(value, *(_type const *) ra_view_get_unsafe(view, i))) { \
+                    if(!counting) return i; \
+                    found++; \
+                } \
+            } \
+            return (counting) ? found : -1; \
+        }
+
     RA_MEMBER_AT_TYPE(RA_INT, int);
-    RA_MEMBER_AT_TYPE_CMP(RA_STR, char *, strcmp);
+    RA_MEMBER_AT_PNT_TYPE(RA_STR, char *, RA_EQ_STR);
     //gen 4 "Get members."
 	RA_MEMBER_AT_TYPE(RA_FLOAT, double);
+	RA_MEMBER_AT_PROMOTED_TYPE(RA_F32, float, double);
 	RA_MEMBER_AT_TYPE_CMP(RA_VECTOR3, Vector3, Vector3Equals);
 	RA_MEMBER_AT_TYPE_CMP(RA_VECTOR2, Vector2, Vector2Equals);
 	RA_MEMBER_AT_TYPE_CMP(RA_WECTANGLE, Wectangle, WectangleEquals);
+	RA_MEMBER_AT_TYPE_CMP(RA_WECPAIR, WecPair, WecPairEquals);
     
-    return -1;
+    return (counting) ? 0 : -1;
+}
+
+int ra_vmember_at(r_array * ra, va_list args) {
+    // sorted arrays can binary search, as long as the ordering agrees with the type's equality (it doesn't for e.g. Vector2Equals(), which is approximate)
+    if(ra->sorted && ra->index == NULL) {
+        va_list ordered_args;
+        va_copy(ordered_args, args);
+        long long output = ra_internal_vordered(ra, &ordered_args, RA_ORDERED_MEMBER);
+        va_end(ordered_args);
+        if(output != -2) return (int) output;
+    }
+
+    return (int) ra_internal_vmember_at(ra, ra_view_of(ra), args, false);
+}
+
+int ra_view_member_at(ra_view view, ...) {
+    va_list args;
+    va_start(args, view);
+    int output = (int) ra_internal_vmember_at(NULL, view, args, false);
+    va_end(args);
+
+    return output;
+}
+
+bool ra_view_member_of(ra_view view, ...) {
+    va_list args;
+    va_start(args, view);
+    int output = (int) ra_internal_vmember_at(NULL, view, args, false);
+    va_end(args);
+
+    return (output >= 0);
+}
+
+size_t ra_count_of(r_array * ra, ...) {
+    va_list args;
+    va_start(args, ra);
+    size_t output = (size_t) ra_internal_vmember_at(ra, ra_view_of(ra), args, true);
+    va_end(args);
+
+    return output;
+}
+
+size_t ra_view_count(ra_view view, ...) {
+    va_list args;
+    va_start(args, view);
+    size_t output = (size_t) ra_internal_vmember_at(NULL, view, args, true);
+    va_end(args);
+
+    return output;
+}
+
+size_t ra_internal_hash_element(r_array * ra, const void * element) {
+    if(ra->type.size < 0) {
+        const char * str = *(const char * const *) element;
+        return ra_internal_hash_bytes((const unsigned char *) str, strlen(str));
+    }
+    return ra_internal_hash_bytes(element, ra->type.size);
+}
+
+bool ra_internal_elements_equal(r_array * ra, const void * a, const void * b) {
+    if(ra->type.size < 0) return strcmp(*(const char * const *) a, *(const char * const *) b) == 0;
+    return memcmp(a, b, ra->type.size) == 0;
+}
+
+// find the slot holding an element equal to `element`, or the empty slot where it would go
+size_t ra_internal_index_probe(r_array * ra, const void * element, size_t hash) {
+    size_t mask = ra->index->capacity - 1;
+    size_t i = hash & mask;
+
+    while(ra->index->slots[i].position != 0) {
+        ra_index_slot slot = ra->index->slots[i];
+        if(slot.hash == hash && ra_internal_elements_equal(ra, element, ra->memory.root + (slot.position - 1) * abs(ra->type.size))) break;
+        i = (i + 1) & mask;
+    }
+
+    return i;
+}
+
+// keep the load factor at or under 1/2, so probe sequences stay short
+bool ra_internal_index_resize(r_array * ra, size_t capacity) {
+    ra_index_slot * slots = calloc(capacity, sizeof(ra_index_slot));
+    if(slots == NULL) return false;
+
+    ra_index_slot * old_slots = ra->index->slots;
+    size_t old_capacity = ra->index->capacity;
+
+    for(size_t i = 0; i < old_capacity; i++) {
+        if(old_slots[i].position == 0) continue;
+        size_t j = old_slots[i].hash & (capacity - 1);
+        while(slots[j].position != 0) j = (j + 1) & (capacity - 1);
+        slots[j] = old_slots[i];
+    }
+
+    free(old_slots);
+    ra->index->slots = slots;
+    ra->index->capacity = capacity;
+    return true;
+}
+
+bool ra_index_enable(r_array * ra) {
+    if(ra->index != NULL) return true;
+
+    // the index hashes and compares bytes, so it would find different things than the type's comparison does for anything else
+    bool indexable = false;
+    #define RA_INDEXABLE_TYPE(pair, _type) if(strcmp(#_type, ra->type.typename) == 0) indexable = true
+
+    RA_INDEXABLE_TYPE(RA_INT, int);
+    RA_INDEXABLE_TYPE(RA_STR, char *);
+    //gen 9 "Indexable types."
+
+    if(!indexable) {
+        #ifndef RA_SILENT
+        printf("ra_index_enable: Can't index ra <%p>; %s has no exact equality!\n", ra, ra->type.typename);
+        #endif
+        return false;
+    }
+
+    ra->index = calloc(1, sizeof(ra_index));
+    if(ra->index == NULL) return false;
+
+    size_t capacity = 16;
+    while(capacity < ra->count * 2) capacity *= 2;
+
+    ra->index->slots = calloc(capacity, sizeof(ra_index_slot));
+    if(ra->index->slots == NULL) {
+        free(ra->index);
+        ra->index = NULL;
+        return false;
+    }
+    ra->index->capacity = capacity;
+
+    for(size_t i = 0; i < ra->count; i++) ra_index_insert(ra, i);
+    return true;
+}
+
+void ra_index_disable(r_array * ra) {
+    if(ra->index == NULL) return;
+
+    free(ra->index->slots);
+    free(ra->index);
+    ra->index = NULL;
+}
+
+void ra_index_rebuild(r_array * ra) {
+    memset(ra->index->slots, 0, ra->index->capacity * sizeof(ra_index_slot));
+    ra->index->count = 0;
+
+    for(size_t i = 0; i < ra->count; i++) ra_index_insert(ra, i);
+}
+
+int ra_index_find(r_array * ra, const void * element) {
+    size_t hash = ra_internal_hash_element(ra, element);
+    ra_index_slot slot = ra->index->slots[ra_internal_index_probe(ra, element, hash)];
+    return (slot.position == 0) ? -1 : (int) (slot.position - 1);
+}
+
+void ra_index_insert(r_array * ra, size_t idx) {
+    if((ra->index->count + 1) * 2 > ra->index->capacity) {
+        if(!ra_internal_index_resize(ra, ra->index->capacity * 2)) {
+            // out of memory; an index that's missing elements would give wrong answers, so drop it and go back to scanning
+            ra_index_disable(ra);
+            return;
+        }
+    }
+
+    void * element = ra->memory.root + idx * abs(ra->type.size);
+    size_t hash = ra_internal_hash_element(ra, element);
+    size_t i = ra_internal_index_probe(ra, element, hash);
+    if(ra->index->slots[i].position != 0) return; // an earlier occurrence is already indexed
+
+    ra->index->slots[i] = (ra_index_slot) { .hash = hash, .position = idx + 1 };
+    ra->index->count++;
+}
+
+void ra_index_remove(r_array * ra, size_t idx) {
+    void * element = ra->memory.root + idx * abs(ra->type.size);
+    size_t hash = ra_internal_hash_element(ra, element);
+    size_t i = ra_internal_index_probe(ra, element, hash);
+    if(ra->index->slots[i].position != idx + 1) return; // not indexed, or an earlier duplicate is the indexed one
+
+    // backward-shift deletion, so linear probing doesn't need tombstones
+    size_t mask = ra->index->capacity - 1;
+    size_t j = i;
+    ra->index->slots[i].position = 0;
+    ra->index->count--;
+
+    while(true) {
+        j = (j + 1) & mask;
+        if(ra->index->slots[j].position == 0) return;
+
+        size_t home = ra->index->slots[j].hash & mask;
+        // the entry at j can move into the hole at i if its home isn't cyclically within (i, j]
+        bool stays = (i <= j) ? (i < home && home <= j) : (i < home || home <= j);
+        if(stays) continue;
+
+        ra->index->slots[i] = ra->index->slots[j];
+        ra->index->slots[j].position = 0;
+        i = j;
+    }
 }
 
 void ra_printf(r_array * ra, const char * format_string) {
-    if(ra->count == 0) {
+    ra_view_printf(ra_view_of(ra), format_string);
+}
+
+void ra_view_printf(ra_view view, const char * format_string) {
+    if(view.count == 0) {
         printf("[ empty ]\n");
         return;
     }
@@ -485,11 +3170,11 @@ void ra_printf(r_array * ra, const char * format_string) {
     strncpy(comma_format_string + 2, format_string, strlen(format_string));
 
     #define RA_PRINTF_TYPE(pair, _type) \
-        if(strcmp(pair.typename, ra->type.typename) == 0) { \
-            _type value = *(_type *) ra_get(ra, 0); \
+        if(strcmp(pair.typename, view.typename) == 0) { \
+            _type value = *(_type const *) ra_view_get_unsafe(view, 0); \
             printf(format_string, value); \
-            for(size_t i = 1; i < ra->count; i++) { \
-                _type value = *(_type *) ra_get(ra, i); \
+            for(size_t i = 1; i < view.count; i++) { \
+                _type value = *(_type const *) ra_view_get_unsafe(view, i); \
                 printf(comma_format_string, value); \
             } \
             printf(" ]\n"); \
@@ -500,7 +3185,29 @@ void ra_printf(r_array * ra, const char * format_string) {
     RA_PRINTF_TYPE(RA_STR, char *);
     //gen 5 "Print values."
 	RA_PRINTF_TYPE(RA_FLOAT, double);
+	RA_PRINTF_TYPE(RA_F32, float);
 	RA_PRINTF_TYPE(RA_VECTOR3, Vector3);
 	RA_PRINTF_TYPE(RA_VECTOR2, Vector2);
 	RA_PRINTF_TYPE(RA_WECTANGLE, Wectangle);
+	RA_PRINTF_TYPE(RA_WECPAIR, WecPair);
 }
+
+//----------------------------
+// typed arrays
+
+RA_DEFINE_TYPED(RA_INT, int, int, RA_EQ_PRIMITIVE, RA_FIND_INTS, RA_FIND_SORTED);
+RA_DEFINE_TYPED_ORDERED(RA_INT, int, int, RA_LESS_PRIMITIVE);
+RA_DEFINE_TYPED_PNT(RA_STR, char *, str, RA_EQ_STR);
+RA_DEFINE_TYPED_ORDERED(RA_STR, char *, str, RA_LESS_STR);
+//gen 6 "Typed arrays."
+RA_DEFINE_TYPED(RA_FLOAT, double, double, RA_EQ_PRIMITIVE, RA_FIND_DOUBLES, RA_FIND_SORTED);
+RA_DEFINE_TYPED_ORDERED(RA_FLOAT, double, double, RA_LESS_PRIMITIVE);
+RA_DEFINE_TYPED(RA_F32, float, float, RA_EQ_PRIMITIVE, RA_FIND_SCAN, RA_FIND_SORTED);
+RA_DEFINE_TYPED_ORDERED(RA_F32, float, float, RA_LESS_PRIMITIVE);
+RA_DEFINE_TYPED(RA_VECTOR3, Vector3, Vector3, Vector3Equals, RA_FIND_FLOATS3, RA_FIND_FLOATS3);
+RA_DEFINE_TYPED_ORDERED(RA_VECTOR3, Vector3, Vector3, RA_LESS_XYZ);
+RA_DEFINE_TYPED(RA_VECTOR2, Vector2, Vector2, Vector2Equals, RA_FIND_FLOATS2, RA_FIND_FLOATS2);
+RA_DEFINE_TYPED_ORDERED(RA_VECTOR2, Vector2, Vector2, RA_LESS_XY);
+RA_DEFINE_TYPED(RA_WECTANGLE, Wectangle, Wectangle, WectangleEquals, RA_FIND_SCAN, RA_FIND_SCAN);
+RA_DEFINE_TYPED(RA_WECPAIR, WecPair, WecPair, WecPairEquals, RA_FIND_SCAN, RA_FIND_SCAN);
+RA_DEFINE_TYPED_ORDERED(RA_WECPAIR, WecPair, WecPair, WecPairLess);
@@ -0,0 +1,200 @@
+//------------------------------------------------------------------------------
+// ra_bench - startup and RSS cost of creating (and copying) big r_arrays.
+//
+// Compares the old `aa_create()` (malloc + memset of the whole capacity) and
+// the old `ra_copy()` (memcpy of the whole capacity) against the current ones.
+// Each case runs in its own process so peak RSS isn't shared between them.
+//
+// Then a stress test of concurrent appends: many threads appending to one
+// array, with `ra_append_concurrent()`, `ra_append_n_concurrent()` and, for
+// comparison, `ra_append()` behind a mutex. Exits nonzero if any element is
+// lost or duplicated.
+// POSIX only (fork, getrusage, pthreads).
+//
+// gcc -O2 ra_bench.c -o ra_bench -lraylib -lm -lpthread && ./ra_bench
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "r_array.h"
+
+#define BENCH_ARRAYS 16
+#define BENCH_CAPACITY (1 << 20) // elements per array
+#define BENCH_LIVE 1024 // elements actually appended per array
+
+#define STRESS_THREADS 16
+#define STRESS_PER_THREAD 100000 // elements appended by each thread
+#define STRESS_BATCH 64 // elements per ra_append_n_concurrent()
+
+//-----------------------------------------------------------------------------
+
+// called through a volatile pointer, otherwise gcc turns malloc + memset into calloc and there's nothing to compare
+void * (* volatile legacy_memset)(void *, int, size_t) = memset;
+
+// what aa_create() used to do
+aa_arena legacy_aa_create(size_t capacity) {
+    aa_arena output = (aa_arena) { .root = malloc(capacity), .capacity = capacity };
+    output.position = output.root;
+    legacy_memset(output.root, 0, capacity);
+    return output;
+}
+
+// what ra_copy() used to do
+r_array legacy_ra_copy(r_array * ra) {
+    r_array output = { .count = ra->count, .type = ra->type, .memory = legacy_aa_create(ra->memory.capacity) };
+    output.memory.position += (abs(ra->type.size) * ra->count);
+    memcpy(output.memory.root, ra->memory.root, ra->memory.capacity);
+    return output;
+}
+
+double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+long peak_rss_kb(void) {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+void run_case(int which) {
+    static const char * names[] = { "create (malloc + memset)", "create (calloc)", "create (unzeroed)", "copy (whole capacity)", "copy (live bytes)" };
+    r_array arrays[BENCH_ARRAYS];
+    r_array copies[BENCH_ARRAYS];
+
+    double start = now_ms();
+
+    for(int i = 0; i < BENCH_ARRAYS; i++) {
+        r_array ra = { .type = RA_INT, .count = 0 };
+
+        if(which == 0) ra.memory = legacy_aa_create(BENCH_CAPACITY * sizeof(int));
+        else if(which == 2) ra.memory = aa_create_unzeroed(BENCH_CAPACITY * sizeof(int));
+        else ra.memory = aa_create(BENCH_CAPACITY * sizeof(int));
+
+        for(int j = 0; j < BENCH_LIVE; j++) ra_append(&ra, j);
+        memcpy(&arrays[i], &ra, sizeof(r_array));
+    }
+
+    // the copy cases time the copies only
+    if(which >= 3) {
+        start = now_ms();
+        for(int i = 0; i < BENCH_ARRAYS; i++) {
+            r_array copy = (which == 3) ? legacy_ra_copy(&arrays[i]) : ra_copy(&arrays[i]);
+            memcpy(&copies[i], &copy, sizeof(r_array));
+        }
+    }
+
+    double elapsed = now_ms() - start;
+
+    printf("%-26s %9.3f ms %9ld KiB peak RSS\n", names[which], elapsed, peak_rss_kb());
+
+    for(int i = 0; i < BENCH_ARRAYS; i++) {
+        ra_destroy(&arrays[i]);
+        if(which >= 3) ra_destroy(&copies[i]);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+typedef struct {
+    r_array * ra;
+    int thread;
+    int mode;
+    pthread_mutex_t * lock;
+} stress_job;
+
+void * stress_thread(void * arg) {
+    stress_job * job = arg;
+    int first = job->thread * STRESS_PER_THREAD;
+
+    if(job->mode == 0) {
+        for(int i = 0; i < STRESS_PER_THREAD; i++) {
+            pthread_mutex_lock(job->lock);
+            ra_append(job->ra, first + i);
+            pthread_mutex_unlock(job->lock);
+        }
+    } else if(job->mode == 1) {
+        for(int i = 0; i < STRESS_PER_THREAD; i++) {
+            int value = first + i;
+            if(ra_append_concurrent(job->ra, &value) == NULL) return NULL;
+        }
+    } else {
+        int batch[STRESS_BATCH];
+        for(int i = 0; i < STRESS_PER_THREAD; i += STRESS_BATCH) {
+            int n = (STRESS_PER_THREAD - i < STRESS_BATCH) ? STRESS_PER_THREAD - i : STRESS_BATCH;
+            for(int j = 0; j < n; j++) batch[j] = first + i + j;
+            if(ra_append_n_concurrent(job->ra, batch, n) == NULL) return NULL;
+        }
+    }
+
+    return NULL;
+}
+
+// appends from every thread at once, then checks each value made it in exactly once
+bool run_stress(int mode) {
+    static const char * names[] = { "ra_append (mutex)", "ra_append_concurrent", "ra_append_n_concurrent" };
+    size_t total = (size_t) STRESS_THREADS * STRESS_PER_THREAD;
+
+    r_array ra = ra_create_cap(RA_INT, total);
+    pthread_t threads[STRESS_THREADS];
+    stress_job jobs[STRESS_THREADS];
+    pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+    double start = now_ms();
+    for(int i = 0; i < STRESS_THREADS; i++) {
+        jobs[i] = (stress_job) { &ra, i, mode, &lock };
+        pthread_create(&threads[i], NULL, stress_thread, &jobs[i]);
+    }
+    for(int i = 0; i < STRESS_THREADS; i++) pthread_join(threads[i], NULL);
+    double elapsed = now_ms() - start;
+
+    bool * seen = calloc(total, sizeof(bool));
+    size_t lost = total;
+    size_t bad = 0;
+    for(size_t i = 0; i < ra.count; i++) {
+        int value = ((int *) ra.memory.root)[i];
+        if(value < 0 || (size_t) value >= total || seen[value]) {
+            bad++;
+            continue;
+        }
+        seen[value] = true;
+        lost--;
+    }
+    bool ok = (ra.count == total) && (lost == 0) && (bad == 0) && ((size_t) (ra.memory.position - ra.memory.root) == total * sizeof(int));
+
+    printf("%-26s %9.3f ms %9zu appended, %zu lost, %zu bad: %s\n", names[mode], elapsed, ra.count, lost, bad, ok ? "ok" : "FAILED");
+
+    free(seen);
+    ra_destroy(&ra);
+    return ok;
+}
+
+int main(void) {
+    printf("%d arrays of %d ints (%d appended each)\n\n", BENCH_ARRAYS, BENCH_CAPACITY, BENCH_LIVE);
+
+    for(int which = 0; which < 5; which++) {
+        fflush(stdout);
+        pid_t pid = fork();
+        if(pid == 0) {
+            run_case(which);
+            exit(0);
+        }
+        waitpid(pid, NULL, 0);
+    }
+
+    printf("\n%d threads appending %d ints each to one array\n\n", STRESS_THREADS, STRESS_PER_THREAD);
+
+    bool ok = true;
+    for(int mode = 0; mode < 3; mode++) ok &= run_stress(mode);
+
+    return ok ? 0 : 1;
+}
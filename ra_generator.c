@@ -5,23 +5,28 @@
 
 #include "r_array_template.h"
 
-r_array header_files = RA_STATIC_INIT(RA_STR);
+r_array * header_files = NULL; // set up in main(); RA_STATIC_INIT() is not a constant expression, so it can't initialize a global
 
 void generation_init();
-void register_new_type(const char * typename, const char * associated_type, const char * header_file, const char * comparison_function);
+void register_new_type(const char * typename, const char * associated_type, const char * header_file, const char * comparison_function, const char * less_function);
 void generate_ra(const char * output_filename);
 
 //------------------------------------------------------------------------------
 
 int main(void) {
-    header_files.memory = aa_create(1024);
+    r_array header_file_storage = RA_STATIC_INIT(RA_STR);
+    header_file_storage.memory = aa_create(1024);
+    header_files = &header_file_storage;
+    ra_index_enable(header_files); // register_new_type() dedupes with ra_member_at()
 
-    register_new_type("RA_FLOAT", "double", NULL, NULL);
-    register_new_type("RA_VECTOR3", "Vector3", "<raymath.h>", "Vector3Equals");
-    register_new_type("RA_VECTOR2", "Vector2", "<raymath.h>", "Vector2Equals");
-    register_new_type("RA_WECTANGLE", "Wectangle", "wectangle3.h", "WectangleEquals");
+    register_new_type("RA_FLOAT", "double", NULL, NULL, NULL);
+    register_new_type("RA_F32", "float", NULL, NULL, NULL);
+    register_new_type("RA_VECTOR3", "Vector3", "<raymath.h>", "Vector3Equals", "RA_LESS_XYZ");
+    register_new_type("RA_VECTOR2", "Vector2", "<raymath.h>", "Vector2Equals", "RA_LESS_XY");
+    register_new_type("RA_WECTANGLE", "Wectangle", "wectangle3.h", "WectangleEquals", NULL);
+    register_new_type("RA_WECPAIR", "WecPair", "wectangle3.h", "WecPairEquals", "WecPairLess");
 
-    ra_printf(&header_files, "%s");
+    ra_printf(header_files, "%s");
 
     generate_ra("r_array.h");
 
@@ -34,10 +39,87 @@ struct ArrayType {
     const char * typename;
     const char * associated_type;
     const char * comparison_function;
+    const char * less_function;
     int header_file_idx;
     bool pointer_type;
 };
 
+// the suffix for the typed API, e.g. "Vector2" for `r_array_Vector2`; "unsigned int" becomes "unsigned_int", "char *" becomes "char_p"
+void typed_suffix(const char * associated_type, char * buffer, size_t buffer_size) {
+    size_t j = 0;
+    for(size_t i = 0; associated_type[i] != 0 && j + 1 < buffer_size; i++) {
+        char c = associated_type[i];
+        if(c == '*') {
+            if(j > 0 && buffer[j - 1] != '_') buffer[j++] = '_';
+            if(j + 1 < buffer_size) buffer[j++] = 'p';
+        } else if(c == ' ') {
+            if(j > 0 && buffer[j - 1] != '_') buffer[j++] = '_';
+        } else {
+            buffer[j++] = c;
+        }
+    }
+    while(j > 0 && buffer[j - 1] == '_') j--;
+    buffer[j] = 0;
+}
+
+// the ordering `ra_sort()` uses for a type: the registered one, or `<` for primitives and `strcmp()` for strings; NULL if the type can't be sorted
+const char * ordering_of(struct ArrayType t) {
+    if(t.less_function != NULL) return t.less_function;
+    if(t.pointer_type) return "RA_LESS_STR";
+    if(t.comparison_function == NULL) return "RA_LESS_PRIMITIVE";
+    return NULL;
+}
+
+// the search kernel RA_DEFINE_TYPED() scans with: one that agrees with the type's equality (see ra_internal_kernels[] in r_array_template.h), or a plain loop
+const char * find_of(const char * type, const char * eq) {
+    const char * kernels[][3] = {
+        { "int", "RA_EQ_PRIMITIVE", "RA_FIND_INTS" },
+        { "double", "RA_EQ_PRIMITIVE", "RA_FIND_DOUBLES" },
+        { "Vector2", "Vector2Equals", "RA_FIND_FLOATS2" },
+        { "Vector3", "Vector3Equals", "RA_FIND_FLOATS3" },
+    };
+
+    for(size_t i = 0; i < sizeof(kernels) / sizeof(kernels[0]); i++) {
+        if(strcmp(type, kernels[i][0]) == 0 && strcmp(eq, kernels[i][1]) == 0) return kernels[i][2];
+    }
+    return "RA_FIND_SCAN";
+}
+
+// how RA_DEFINE_SORT() radix sorts big buffers; only the primitive ordering of ints and doubles can be
+const char * radix_of(struct ArrayType t) {
+    const char * less = ordering_of(t);
+    if(less == NULL || strcmp(less, "RA_LESS_PRIMITIVE") != 0) return "RA_RADIX_NONE";
+    if(strcmp(t.associated_type, "int") == 0) return "RA_RADIX_INTS";
+    if(strcmp(t.associated_type, "double") == 0) return "RA_RADIX_DOUBLES";
+    return "RA_RADIX_NONE";
+}
+
+// whether ra_index_enable() can index a type: the index compares bytes (strings by content), so the type's equality has to as well; floating point `==` doesn't (-0.0 == 0.0), and custom comparisons may not
+bool indexable(struct ArrayType t) {
+    const char * floating[] = { "float", "double", "long double" };
+
+    if(t.pointer_type) return t.comparison_function == NULL;
+    if(t.comparison_function != NULL) return false;
+    for(size_t i = 0; i < sizeof(floating) / sizeof(floating[0]); i++) {
+        if(strcmp(t.associated_type, floating[i]) == 0) return false;
+    }
+    return true;
+}
+
+// what `...` turns a type into (float to double, small integers to int), or NULL if it passes through as-is; va_arg() has to ask for that
+const char * promoted_type_of(struct ArrayType t) {
+    const char * to_double[] = { "float" };
+    const char * to_int[] = { "char", "signed char", "unsigned char", "short", "unsigned short", "bool", "_Bool" };
+
+    for(size_t i = 0; i < sizeof(to_double) / sizeof(to_double[0]); i++) {
+        if(strcmp(t.associated_type, to_double[i]) == 0) return "double";
+    }
+    for(size_t i = 0; i < sizeof(to_int) / sizeof(to_int[0]); i++) {
+        if(strcmp(t.associated_type, to_int[i]) == 0) return "int";
+    }
+    return NULL;
+}
+
 struct ArrayType * registered_types;
 unsigned int num_registered_types = 0;
 
@@ -45,19 +127,20 @@ void generation_init() {
     registered_types = malloc(0);
 }
 
-void register_new_type(const char * typename, const char * associated_type, const char * header_file, const char * comparison_function) {
+// `less_function` can be NULL for primitives (they get `<`), and for types that shouldn't be sortable
+void register_new_type(const char * typename, const char * associated_type, const char * header_file, const char * comparison_function, const char * less_function) {
     int idx = -1;
     if(header_file != NULL) {
-        int idx_at = ra_member_at(&header_files, header_file);
+        int idx_at = ra_member_at(header_files, header_file);
         if(idx_at >= 0) {
-            idx = -1;
+            idx = idx_at;
         } else {
-            ra_append(&header_files, header_file);
-            idx = header_files.count - 1;
+            ra_append(header_files, header_file);
+            idx = header_files->count - 1;
         }
     }
 
-    struct ArrayType new = { .typename = typename, .associated_type = associated_type, .header_file_idx = idx, .pointer_type = false, .comparison_function = comparison_function };
+    struct ArrayType new = { .typename = typename, .associated_type = associated_type, .header_file_idx = idx, .pointer_type = false, .comparison_function = comparison_function, .less_function = less_function };
 
     num_registered_types++;
     registered_types = realloc(registered_types, num_registered_types * sizeof(struct ArrayType));
@@ -118,12 +201,18 @@ void generate_ra(const char * output_filename) {
                     for(unsigned int i = 0; i < num_registered_types; i++) {
                         // const char * header_file = registered_types[i].header_file;
                         struct ArrayType t = registered_types[i];
-                        const char * header_file = (t.header_file_idx >= 0) ? *(const char **) ra_get(&header_files, t.header_file_idx) : NULL;
+                        const char * header_file = (t.header_file_idx >= 0) ? *(const char **) ra_get(header_files, t.header_file_idx) : NULL;
                         if(header_file == NULL) {
                             printf("\t* No header needed for %s (%s).\n", t.typename, t.associated_type);
                             continue; // no header file needed because this is a primitive
                         }
 
+                        bool already_included = false;
+                        for(unsigned int j = 0; j < i; j++) {
+                            if(registered_types[j].header_file_idx == t.header_file_idx) already_included = true;
+                        }
+                        if(already_included) continue; // types can share a header
+
                         if(header_file[0] == '<') {
                             // use angle brackets
                             fprintf(output, "#include %s // for %s\n", header_file, t.associated_type);
@@ -143,11 +232,11 @@ void generate_ra(const char * output_filename) {
                         struct ArrayType t = registered_types[i];
                     
                         if(t.pointer_type) {
-                            fprintf(output, "ra_type %s = DEFINE_RA_PNT_TYPE(%s); // from %s\n", t.typename, t.associated_type, (t.header_file_idx >= 0) ? *(const char **) ra_get(&header_files, t.header_file_idx) : "stdlib");
-                            fprintf(stdout, "\t* ra_type %s = DEFINE_RA_PNT_TYPE(%s); // from %s\n", t.typename, t.associated_type, (t.header_file_idx >= 0) ? *(const char **) ra_get(&header_files, t.header_file_idx) : "stdlib");
+                            fprintf(output, "ra_type %s = DEFINE_RA_PNT_TYPE(%s); // from %s\n", t.typename, t.associated_type, (t.header_file_idx >= 0) ? *(const char **) ra_get(header_files, t.header_file_idx) : "stdlib");
+                            fprintf(stdout, "\t* ra_type %s = DEFINE_RA_PNT_TYPE(%s); // from %s\n", t.typename, t.associated_type, (t.header_file_idx >= 0) ? *(const char **) ra_get(header_files, t.header_file_idx) : "stdlib");
                         } else {
-                            fprintf(output, "ra_type %s = DEFINE_RA_TYPE(%s); // from %s\n", t.typename, t.associated_type, (t.header_file_idx >= 0) ? *(const char **) ra_get(&header_files, t.header_file_idx) : "stdlib");
-                            fprintf(stdout, "\t* ra_type %s = DEFINE_RA_TYPE(%s); // from %s\n", t.typename, t.associated_type, (t.header_file_idx >= 0) ? *(const char **) ra_get(&header_files, t.header_file_idx) : "stdlib");
+                            fprintf(output, "ra_type %s = DEFINE_RA_TYPE(%s); // from %s\n", t.typename, t.associated_type, (t.header_file_idx >= 0) ? *(const char **) ra_get(header_files, t.header_file_idx) : "stdlib");
+                            fprintf(stdout, "\t* ra_type %s = DEFINE_RA_TYPE(%s); // from %s\n", t.typename, t.associated_type, (t.header_file_idx >= 0) ? *(const char **) ra_get(header_files, t.header_file_idx) : "stdlib");
                         }
                     }
 
@@ -161,6 +250,9 @@ void generate_ra(const char * output_filename) {
                         if(t.pointer_type) {
                             fprintf(output, "\tRA_APPEND_PNT_TYPE(%s, %s);\n", t.typename, t.associated_type);
                             fprintf(stdout, "\t* RA_APPEND_PNT_TYPE(%s, %s);\n", t.typename, t.associated_type);
+                        } else if(promoted_type_of(t) != NULL) {
+                            fprintf(output, "\tRA_APPEND_PROMOTED_TYPE(%s, %s, %s);\n", t.typename, t.associated_type, promoted_type_of(t));
+                            fprintf(stdout, "\t* RA_APPEND_PROMOTED_TYPE(%s, %s, %s);\n", t.typename, t.associated_type, promoted_type_of(t));
                         } else {
                             fprintf(output, "\tRA_APPEND_TYPE(%s, %s);\n", t.typename, t.associated_type);
                             fprintf(stdout, "\t* RA_APPEND_TYPE(%s, %s);\n", t.typename, t.associated_type);
@@ -174,9 +266,16 @@ void generate_ra(const char * output_filename) {
                     for(unsigned int i = 0; i < num_registered_types; i++) {
                         struct ArrayType t = registered_types[i];
                     
-                        if(t.comparison_function != NULL) {
+                        if(t.pointer_type) {
+                            const char * eq = (t.comparison_function != NULL) ? t.comparison_function : "RA_EQ_STR";
+                            fprintf(output, "\tRA_MEMBER_AT_PNT_TYPE(%s, %s, %s);\n", t.typename, t.associated_type, eq);
+                            fprintf(stdout, "\t* RA_MEMBER_AT_PNT_TYPE(%s, %s, %s);\n", t.typename, t.associated_type, eq);
+                        } else if(t.comparison_function != NULL) {
                             fprintf(output, "\tRA_MEMBER_AT_TYPE_CMP(%s, %s, %s);\n", t.typename, t.associated_type, t.comparison_function);
                             fprintf(stdout, "\t* RA_MEMBER_AT_TYPE_CMP(%s, %s, %s);\n", t.typename, t.associated_type, t.comparison_function);
+                        } else if(promoted_type_of(t) != NULL) {
+                            fprintf(output, "\tRA_MEMBER_AT_PROMOTED_TYPE(%s, %s, %s);\n", t.typename, t.associated_type, promoted_type_of(t));
+                            fprintf(stdout, "\t* RA_MEMBER_AT_PROMOTED_TYPE(%s, %s, %s);\n", t.typename, t.associated_type, promoted_type_of(t));
                         } else {
                             fprintf(output, "\tRA_MEMBER_AT_TYPE(%s, %s);\n", t.typename, t.associated_type);
                             fprintf(stdout, "\t* RA_MEMBER_AT_TYPE(%s, %s);\n", t.typename, t.associated_type);
@@ -195,6 +294,89 @@ void generate_ra(const char * output_filename) {
 
                     break;
                 }
+                case 6: {
+                    // typed arrays
+                    for(unsigned int i = 0; i < num_registered_types; i++) {
+                        struct ArrayType t = registered_types[i];
+                        char suffix[128];
+                        typed_suffix(t.associated_type, suffix, 128);
+                        const char * eq = (t.comparison_function != NULL) ? t.comparison_function : (t.pointer_type ? "RA_EQ_STR" : "RA_EQ_PRIMITIVE");
+
+                        if(t.pointer_type) {
+                            fprintf(output, "RA_DEFINE_TYPED_PNT(%s, %s, %s, %s);\n", t.typename, t.associated_type, suffix, eq);
+                            fprintf(stdout, "\t* RA_DEFINE_TYPED_PNT(%s, %s, %s, %s);\n", t.typename, t.associated_type, suffix, eq);
+                        } else {
+                            const char * find = find_of(t.associated_type, eq);
+                            // binary search sorted arrays only when the ordering agrees with the type's equality, like ra_member_at() does (see case 8)
+                            const char * sorted_find = (ordering_of(t) != NULL && t.comparison_function == NULL) ? "RA_FIND_SORTED" : find;
+                            fprintf(output, "RA_DEFINE_TYPED(%s, %s, %s, %s, %s, %s);\n", t.typename, t.associated_type, suffix, eq, find, sorted_find);
+                            fprintf(stdout, "\t* RA_DEFINE_TYPED(%s, %s, %s, %s, %s, %s);\n", t.typename, t.associated_type, suffix, eq, find, sorted_find);
+                        }
+
+                        const char * less = ordering_of(t);
+                        if(less != NULL) {
+                            fprintf(output, "RA_DEFINE_TYPED_ORDERED(%s, %s, %s, %s);\n", t.typename, t.associated_type, suffix, less);
+                            fprintf(stdout, "\t* RA_DEFINE_TYPED_ORDERED(%s, %s, %s, %s);\n", t.typename, t.associated_type, suffix, less);
+                        }
+                    }
+
+                    break;
+                }
+                case 7: {
+                    // sort functions
+                    for(unsigned int i = 0; i < num_registered_types; i++) {
+                        struct ArrayType t = registered_types[i];
+                        const char * less = ordering_of(t);
+                        if(less == NULL) {
+                            printf("\t* No ordering for %s (%s).\n", t.typename, t.associated_type);
+                            continue;
+                        }
+
+                        char suffix[128];
+                        typed_suffix(t.associated_type, suffix, 128);
+                        fprintf(output, "RA_DEFINE_SORT(%s, %s, %s, %s, %s);\n", t.typename, t.associated_type, suffix, less, radix_of(t));
+                        fprintf(stdout, "\t* RA_DEFINE_SORT(%s, %s, %s, %s, %s);\n", t.typename, t.associated_type, suffix, less, radix_of(t));
+                    }
+
+                    break;
+                }
+                case 8: {
+                    // ra_sort, ra_lower_bound, ra_bsearch
+                    for(unsigned int i = 0; i < num_registered_types; i++) {
+                        struct ArrayType t = registered_types[i];
+                        const char * less = ordering_of(t);
+                        if(less == NULL) continue;
+
+                        char suffix[128];
+                        typed_suffix(t.associated_type, suffix, 128);
+                        // ra_member_at() can only binary search when the ordering agrees with the type's equality; custom comparisons (like the approximate Vector2Equals()) keep scanning
+                        const char * exact = (t.comparison_function == NULL) ? "true" : "false";
+                        if(promoted_type_of(t) != NULL) {
+                            fprintf(output, "\tRA_ORDERED_PROMOTED_TYPE(%s, %s, %s, %s, %s, %s);\n", t.typename, t.associated_type, suffix, less, exact, promoted_type_of(t));
+                            fprintf(stdout, "\t* RA_ORDERED_PROMOTED_TYPE(%s, %s, %s, %s, %s, %s);\n", t.typename, t.associated_type, suffix, less, exact, promoted_type_of(t));
+                        } else {
+                            fprintf(output, "\tRA_ORDERED_TYPE(%s, %s, %s, %s, %s);\n", t.typename, t.associated_type, suffix, less, exact);
+                            fprintf(stdout, "\t* RA_ORDERED_TYPE(%s, %s, %s, %s, %s);\n", t.typename, t.associated_type, suffix, less, exact);
+                        }
+                    }
+
+                    break;
+                }
+                case 9: {
+                    // ra_index_enable
+                    for(unsigned int i = 0; i < num_registered_types; i++) {
+                        struct ArrayType t = registered_types[i];
+                        if(!indexable(t)) {
+                            printf("\t* %s (%s) can't be indexed.\n", t.typename, t.associated_type);
+                            continue;
+                        }
+
+                        fprintf(output, "\tRA_INDEXABLE_TYPE(%s, %s);\n", t.typename, t.associated_type);
+                        fprintf(stdout, "\t* RA_INDEXABLE_TYPE(%s, %s);\n", t.typename, t.associated_type);
+                    }
+
+                    break;
+                }
                 default: {
                     printf("ERROR: unrecognized step number. Aborting...\n");
                     fclose(output);
@@ -0,0 +1,857 @@
+//-----------------------------------------------------------------------------//
+// RA_PARALLEL - r_arrays across several threads: a work-stealing thread pool, //
+// parallel for/map/filter over arrays, and per-thread shards gathered into    //
+// one contiguous array (or reduced) in parallel.                              //
+// Written for and by wrzeczak 2026.                                           //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+#include "r_array.h"
+
+// gathers smaller than this many bytes are copied on the calling thread; waking the pool costs more than the memcpy
+#ifndef RA_PARALLEL_MIN_BYTES
+    #define RA_PARALLEL_MIN_BYTES (256 * 1024)
+#endif
+
+// how many ranges a worker's deque holds; a range that doesn't fit is just run instead of split further
+#ifndef RA_POOL_DEQUE_CAPACITY
+    #define RA_POOL_DEQUE_CAPACITY 128
+#endif
+
+//------------------------------------------------------------------------------
+
+/**
+ * A range of indices still to run. See `ra_pool`.
+ */
+typedef struct {
+    size_t begin, end;
+} ra_pool_range;
+
+/**
+ * One thread's deque of ranges. The owner pushes and pops at the bottom; thieves take from the top, which holds the biggest ranges, since the owner splits its range in half and pushes the upper half as it goes.
+ */
+typedef struct {
+    ra_pool_range ranges[RA_POOL_DEQUE_CAPACITY];
+    size_t top, bottom;
+    pthread_mutex_t lock;
+} ra_pool_deque;
+
+/**
+ * A fixed pool of worker threads that run index ranges (see `ra_pool_run()`) by work stealing: every thread, the calling one included, has a deque of ranges; a thread splits its range down to the grain size, leaving the halves it split off in its deque, and a thread whose deque runs dry steals from another's. So uneven work (culling, where some elements cost nothing) still spreads over every core. The workers sleep between runs.
+ *
+ * Runs are one at a time; a run started from inside another (e.g. a nested `ra_parallel_for()`) just runs on the thread that started it.
+ *
+ * @param num_threads The number of threads that run work, the calling thread included.
+ * @param workers The `num_threads - 1` worker threads.
+ * @param deques One deque per thread; the calling thread's is `deques[0]`.
+ */
+typedef struct {
+    size_t num_threads;
+    pthread_t * workers;
+    ra_pool_deque * deques;
+
+    pthread_mutex_t lock; // guards the fields below, up to `fn`
+    pthread_cond_t wake, idle;
+    size_t generation; // bumped for every run; workers wake when it changes
+    size_t active; // workers inside a run
+    bool quit;
+
+    pthread_mutex_t submit; // held for the whole of a run
+
+    void (* fn)(size_t begin, size_t end, void * ctx);
+    void * ctx;
+    size_t grain;
+    size_t remaining; // indices not yet run, atomically
+} ra_pool;
+
+//------------------------------------------------------------------------------
+
+/**
+ * An array split into one `r_array` (shard) per thread. Each thread appends to its own shard with the ordinary, non-atomic `ra_append()` & co., so there's no contention at all; `ra_gather()` then stitches the shards into one contiguous array, and `ra_reduce()` sums (or mins, or maxes) them without stitching. The shards are growable.
+ *
+ * A shard must only be touched by one thread at a time. Gathering and reducing read every shard, so do them after the threads are joined.
+ *
+ * @param shards The shards, `num_shards` of them. See `ra_shard()`.
+ * @param num_shards The number of shards.
+ * @param type The type pair every shard holds.
+ */
+typedef struct {
+    r_array * shards;
+    size_t num_shards;
+    ra_type type;
+} ra_sharded;
+
+/**
+ * What `ra_reduce()` computes. Sums are component-wise for vectors, as are minima and maxima.
+ */
+typedef enum { RA_REDUCE_SUM, RA_REDUCE_MIN, RA_REDUCE_MAX } ra_reduce_op;
+
+//------------------------------------------------------------------------------
+
+size_t ra_parallel_threads(void);
+
+ra_pool * ra_pool_create(size_t num_threads);
+void ra_pool_destroy(ra_pool * pool);
+void ra_pool_run(ra_pool * pool, size_t count, void (* fn)(size_t begin, size_t end, void * ctx), void * ctx, size_t grain);
+ra_pool * ra_parallel_pool(void);
+void ra_parallel_shutdown(void);
+
+void ra_parallel_for(r_array * ra, void (* fn)(void * element, size_t idx, void * ctx), void * ctx, size_t grain);
+void * ra_parallel_map(r_array * src, r_array * dst, void (* fn)(const void * in, void * out, size_t idx, void * ctx), void * ctx, size_t grain);
+size_t ra_parallel_filter(r_array * ra, bool (* pred)(const void * element, void * ctx), void * ctx, size_t grain);
+
+ra_sharded ra_sharded_create(ra_type type_pair, size_t num_shards, size_t capacity);
+void ra_sharded_destroy(ra_sharded * sharded);
+r_array * ra_shard(ra_sharded * sharded, size_t which);
+size_t ra_sharded_count(const ra_sharded * sharded);
+void ra_sharded_clear(ra_sharded * sharded);
+
+r_array ra_gather(ra_sharded * sharded, size_t num_threads);
+void * ra_gather_into(ra_sharded * sharded, r_array * dst, size_t num_threads);
+bool ra_reduce(ra_sharded * sharded, ra_reduce_op op, void * result, size_t num_threads);
+
+//------------------------------------------------------------------------------
+// INTERNALS
+
+// whether this thread is running part of an ra_pool_run(); runs started from inside one run inline
+__thread bool ra_internal_pool_inside = false;
+
+// push a range onto the bottom of a deque; false if it's full
+bool ra_internal_deque_push(ra_pool_deque * deque, ra_pool_range range) {
+    pthread_mutex_lock(&deque->lock);
+    if(deque->top == deque->bottom) deque->top = deque->bottom = 0;
+    bool pushed = (deque->bottom < RA_POOL_DEQUE_CAPACITY);
+    if(pushed) deque->ranges[deque->bottom++] = range;
+    pthread_mutex_unlock(&deque->lock);
+    return pushed;
+}
+
+// take a range from the bottom (`steal == false`, the owner) or top (a thief) of a deque; false if it's empty
+bool ra_internal_deque_take(ra_pool_deque * deque, bool steal, ra_pool_range * range) {
+    pthread_mutex_lock(&deque->lock);
+    bool taken = (deque->top < deque->bottom);
+    if(taken) *range = (steal) ? deque->ranges[deque->top++] : deque->ranges[--deque->bottom];
+    pthread_mutex_unlock(&deque->lock);
+    return taken;
+}
+
+// run the pool's current job as thread `self` until every index has been run
+void ra_internal_pool_work(ra_pool * pool, size_t self) {
+    ra_internal_pool_inside = true;
+
+    while(__atomic_load_n(&pool->remaining, __ATOMIC_ACQUIRE) > 0) {
+        ra_pool_range range;
+        bool found = ra_internal_deque_take(&pool->deques[self], false, &range);
+        for(size_t i = 1; !found && i < pool->num_threads; i++) {
+            found = ra_internal_deque_take(&pool->deques[(self + i) % pool->num_threads], true, &range);
+        }
+        if(!found) {
+            // everything left is being run by someone else, or is about to be pushed
+            sched_yield();
+            continue;
+        }
+
+        // leave the upper halves for thieves, and run what's left
+        while(range.end - range.begin > pool->grain) {
+            size_t mid = range.begin + (range.end - range.begin) / 2;
+            if(!ra_internal_deque_push(&pool->deques[self], (ra_pool_range) { mid, range.end })) break;
+            range.end = mid;
+        }
+
+        pool->fn(range.begin, range.end, pool->ctx);
+        __atomic_sub_fetch(&pool->remaining, range.end - range.begin, __ATOMIC_RELEASE);
+    }
+
+    ra_internal_pool_inside = false;
+}
+
+// a worker thread's argument
+typedef struct {
+    ra_pool * pool;
+    size_t self;
+} ra_internal_worker;
+
+void * ra_internal_pool_worker(void * arg) {
+    ra_internal_worker worker = *(ra_internal_worker *) arg;
+    free(arg);
+    ra_pool * pool = worker.pool;
+
+    pthread_mutex_lock(&pool->lock);
+    size_t seen = pool->generation;
+    for(;;) {
+        while(!pool->quit && pool->generation == seen) pthread_cond_wait(&pool->wake, &pool->lock);
+        if(pool->quit) break;
+
+        seen = pool->generation;
+        pool->active++;
+        pthread_mutex_unlock(&pool->lock);
+
+        ra_internal_pool_work(pool, worker.self);
+
+        pthread_mutex_lock(&pool->lock);
+        if(--pool->active == 0) pthread_cond_broadcast(&pool->idle);
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    return NULL;
+}
+
+// run `fn` on each of `count` jobs (`jobs` is an array of `job_size`-byte structs) on the default pool
+typedef struct {
+    void * (* fn)(void *);
+    char * jobs;
+    size_t job_size;
+} ra_internal_jobs;
+
+void ra_internal_jobs_range(size_t begin, size_t end, void * ctx) {
+    ra_internal_jobs * jobs = ctx;
+    for(size_t i = begin; i < end; i++) jobs->fn(jobs->jobs + i * jobs->job_size);
+}
+
+void ra_internal_parallel_run(void * (* fn)(void *), void * jobs, size_t job_size, size_t count) {
+    ra_internal_jobs ctx = { fn, jobs, job_size };
+    ra_pool_run(ra_parallel_pool(), count, ra_internal_jobs_range, &ctx, 1);
+}
+
+// make room for `bytes` more at the end of `dst`, without claiming it (see ra_internal_commit_tail()); returns where they go, or NULL on overflow (or crashes, like aa_alloc())
+void * ra_internal_reserve_tail(r_array * dst, size_t bytes, const char * caller) {
+    aa_grow_for(&dst->memory, bytes); // on failure, fall through to the overflow handling below
+    size_t left = dst->memory.capacity - (size_t) (dst->memory.position - dst->memory.root);
+    if(left < bytes) {
+        #ifndef RA_NO_CRASH_ON_OVERFLOW
+            printf("%s: Attempted to add %zu bytes to ra <%p>, but there were %zu bytes of space left!\n", caller, bytes, dst, left);
+            exit(80085);
+        #else
+            #ifndef RA_SILENT
+            printf("%s: (RA_NO_CRASH_ON_OVERFLOW) Attempted to add %zu bytes to ra <%p>, but there were %zu bytes of space left!\n", caller, bytes, dst, left);
+            #endif
+            return NULL;
+        #endif
+    }
+
+    return dst->memory.position;
+}
+
+// claim `count` elements written past the end of `dst` by ra_internal_reserve_tail()'s caller
+void ra_internal_commit_tail(r_array * dst, size_t count) {
+    dst->memory.position += count * (size_t) dst->type.size;
+    dst->count += count;
+    dst->sorted = false;
+    if(dst->index != NULL) {
+        for(size_t i = dst->count - count; i < dst->count; i++) ra_index_insert(dst, i);
+    }
+}
+
+// one thread's part of ra_gather_into(): the bytes [begin, end) of the gathered array
+typedef struct {
+    ra_sharded * sharded;
+    const size_t * offsets; // the byte offset of each shard in `out`, plus the total at the end
+    char * out;
+    size_t begin, end;
+} ra_internal_gather_job;
+
+void * ra_internal_gather_thread(void * arg) {
+    ra_internal_gather_job * job = arg;
+
+    for(size_t i = 0; i < job->sharded->num_shards; i++) {
+        size_t shard_begin = job->offsets[i];
+        size_t shard_end = job->offsets[i + 1];
+        if(shard_end <= job->begin) continue;
+        if(shard_begin >= job->end) break;
+
+        size_t from = (shard_begin > job->begin) ? shard_begin : job->begin;
+        size_t to = (shard_end < job->end) ? shard_end : job->end;
+        memcpy(job->out + from, (char *) job->sharded->shards[i].memory.root + (from - shard_begin), to - from);
+    }
+
+    return NULL;
+}
+
+// one shard's contribution to ra_reduce(), in the widest type its kernel works in
+typedef struct {
+    ra_view view;
+    bool any; // false for an empty shard, which has no min or max
+    union { long long i; double d; float f[3]; } sum;
+    union { int i; double d; float f[3]; } min, max;
+} ra_internal_reduce_part;
+
+// one thread's part of ra_reduce(): every `step`-th shard from `first`
+typedef struct {
+    ra_internal_reduce_part * parts;
+    size_t first, step, count;
+    ra_reduce_op op;
+} ra_internal_reduce_job;
+
+void * ra_internal_reduce_thread(void * arg) {
+    ra_internal_reduce_job * job = arg;
+
+    for(size_t i = job->first; i < job->count; i += job->step) {
+        ra_internal_reduce_part * part = &job->parts[i];
+        if(job->op == RA_REDUCE_SUM) ra_view_sum(part->view, &part->sum);
+        else part->any = ra_view_minmax(part->view, &part->min, &part->max);
+    }
+
+    return NULL;
+}
+
+//------------------------------------------------------------------------------
+// THREAD POOL
+
+/**
+ * Get the number of hardware threads, i.e. a sensible number of threads for a pool, or of shards (and of pieces for `ra_gather()` and `ra_reduce()`).
+ *
+ * @return The number of online processors; at least 1.
+ */
+size_t ra_parallel_threads(void) {
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return (count < 1) ? 1 : (size_t) count;
+}
+
+/**
+ * Start a thread pool. See `ra_pool`. Most code can use the shared one instead, see `ra_parallel_pool()`. Must be destroyed with `ra_pool_destroy()`.
+ *
+ * @param num_threads The number of threads to run work on, the calling thread included (so `num_threads - 1` are started); `0` for `ra_parallel_threads()`.
+ * @return The pool, `NULL` if it couldn't be allocated. If some workers couldn't be started, it has fewer threads.
+ */
+ra_pool * ra_pool_create(size_t num_threads) {
+    if(num_threads == 0) num_threads = ra_parallel_threads();
+
+    ra_pool * pool = calloc(1, sizeof(ra_pool));
+    if(pool != NULL) {
+        pool->workers = calloc(num_threads, sizeof(pthread_t));
+        pool->deques = calloc(num_threads, sizeof(ra_pool_deque));
+    }
+    if(pool == NULL || pool->workers == NULL || pool->deques == NULL) {
+        #ifndef RA_SILENT
+        printf("ra_pool_create: Couldn't allocate a pool of %zu threads!\n", num_threads);
+        #endif
+        if(pool != NULL) {
+            free(pool->workers);
+            free(pool->deques);
+            free(pool);
+        }
+        return NULL;
+    }
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_mutex_init(&pool->submit, NULL);
+    pthread_cond_init(&pool->wake, NULL);
+    pthread_cond_init(&pool->idle, NULL);
+    for(size_t i = 0; i < num_threads; i++) pthread_mutex_init(&pool->deques[i].lock, NULL);
+
+    // workers only ever look at deques below num_threads, so it can stop short if one fails to start
+    pool->num_threads = 1;
+    for(size_t i = 1; i < num_threads; i++) {
+        ra_internal_worker * worker = malloc(sizeof(ra_internal_worker));
+        if(worker == NULL) break;
+        *worker = (ra_internal_worker) { pool, i };
+
+        if(pthread_create(&pool->workers[i - 1], NULL, ra_internal_pool_worker, worker) != 0) {
+            free(worker);
+            break;
+        }
+        pool->num_threads++;
+    }
+
+    return pool;
+}
+
+/**
+ * Stop a pool's workers and free it. Must not be running anything.
+ */
+void ra_pool_destroy(ra_pool * pool) {
+    if(pool == NULL) return;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->quit = true;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+
+    for(size_t i = 1; i < pool->num_threads; i++) pthread_join(pool->workers[i - 1], NULL);
+
+    for(size_t i = 0; i < pool->num_threads; i++) pthread_mutex_destroy(&pool->deques[i].lock);
+    pthread_mutex_destroy(&pool->lock);
+    pthread_mutex_destroy(&pool->submit);
+    pthread_cond_destroy(&pool->wake);
+    pthread_cond_destroy(&pool->idle);
+    free(pool->workers);
+    free(pool->deques);
+    free(pool);
+}
+
+/**
+ * Run `fn` over the indices `[0, count)` on a pool, in ranges of about `grain` indices, and wait for all of it. The calling thread works too. Which thread runs which range, and in what order, is up to the work stealing; every index is run exactly once.
+ *
+ * @param pool The pool. If it's `NULL`, or this is called from inside a run, everything runs on the calling thread.
+ * @param count The number of indices.
+ * @param fn What to run, on the indices `[begin, end)`.
+ * @param ctx Passed along to `fn`.
+ * @param grain The smallest range worth handing to another thread; `0` picks one that gives each thread several ranges.
+ */
+void ra_pool_run(ra_pool * pool, size_t count, void (* fn)(size_t begin, size_t end, void * ctx), void * ctx, size_t grain) {
+    if(count == 0) return;
+    if(grain == 0) grain = count / ((pool == NULL) ? 1 : pool->num_threads * 8);
+    if(grain == 0) grain = 1;
+
+    if(pool == NULL || pool->num_threads == 1 || count <= grain || ra_internal_pool_inside) {
+        fn(0, count, ctx);
+        return;
+    }
+
+    pthread_mutex_lock(&pool->submit);
+
+    pthread_mutex_lock(&pool->lock);
+    pool->fn = fn;
+    pool->ctx = ctx;
+    pool->grain = grain;
+    __atomic_store_n(&pool->remaining, count, __ATOMIC_RELEASE);
+    ra_internal_deque_push(&pool->deques[0], (ra_pool_range) { 0, count });
+    pool->generation++;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+
+    ra_internal_pool_work(pool, 0);
+
+    // nothing may still be looking at `fn` or `ctx` once this returns
+    pthread_mutex_lock(&pool->lock);
+    while(pool->active > 0) pthread_cond_wait(&pool->idle, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+
+    pthread_mutex_unlock(&pool->submit);
+}
+
+ra_pool * ra_internal_default_pool = NULL;
+pthread_mutex_t ra_internal_default_pool_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * Get the shared pool that `ra_parallel_for()`, `ra_gather()` & co. run on, starting it (with `ra_parallel_threads()` threads) on first use.
+ *
+ * @return The shared pool; `NULL` if it couldn't be started, in which case everything runs on the calling thread.
+ */
+ra_pool * ra_parallel_pool(void) {
+    pthread_mutex_lock(&ra_internal_default_pool_lock);
+    if(ra_internal_default_pool == NULL) ra_internal_default_pool = ra_pool_create(0);
+    ra_pool * pool = ra_internal_default_pool;
+    pthread_mutex_unlock(&ra_internal_default_pool_lock);
+    return pool;
+}
+
+/**
+ * Stop the shared pool's workers, e.g. before exiting. The next parallel call starts it again.
+ */
+void ra_parallel_shutdown(void) {
+    pthread_mutex_lock(&ra_internal_default_pool_lock);
+    ra_pool_destroy(ra_internal_default_pool);
+    ra_internal_default_pool = NULL;
+    pthread_mutex_unlock(&ra_internal_default_pool_lock);
+}
+
+//------------------------------------------------------------------------------
+// PARALLEL LOOPS
+
+// what a parallel loop's ranges need
+typedef struct {
+    char * data;
+    size_t count;
+    size_t size;
+    char * out;
+    size_t out_size;
+    void * fn;
+    void * ctx;
+    unsigned char * keep; // ra_parallel_filter(): whether each element is kept
+    size_t * offsets; // ra_parallel_filter(): where each block's kept elements go
+    size_t block;
+} ra_internal_loop;
+
+void ra_internal_for_range(size_t begin, size_t end, void * ctx) {
+    ra_internal_loop * loop = ctx;
+    void (* fn)(void *, size_t, void *) = loop->fn;
+    for(size_t i = begin; i < end; i++) fn(loop->data + i * loop->size, i, loop->ctx);
+}
+
+void ra_internal_map_range(size_t begin, size_t end, void * ctx) {
+    ra_internal_loop * loop = ctx;
+    void (* fn)(const void *, void *, size_t, void *) = loop->fn;
+    for(size_t i = begin; i < end; i++) fn(loop->data + i * loop->size, loop->out + i * loop->out_size, i, loop->ctx);
+}
+
+// the first pass of ra_parallel_filter(): test every element of some blocks, and count the kept ones per block
+void ra_internal_filter_test_range(size_t begin, size_t end, void * ctx) {
+    ra_internal_loop * loop = ctx;
+    bool (* pred)(const void *, void *) = loop->fn;
+    for(size_t b = begin; b < end; b++) {
+        size_t first = b * loop->block;
+        size_t last = (first + loop->block < loop->count) ? first + loop->block : loop->count;
+        size_t kept = 0;
+        for(size_t i = first; i < last; i++) {
+            loop->keep[i] = pred(loop->data + i * loop->size, loop->ctx);
+            kept += loop->keep[i];
+        }
+        loop->offsets[b + 1] = kept;
+    }
+}
+
+// the second pass: copy each block's kept elements to their place in `out`, in order
+void ra_internal_filter_copy_range(size_t begin, size_t end, void * ctx) {
+    ra_internal_loop * loop = ctx;
+    for(size_t b = begin; b < end; b++) {
+        size_t first = b * loop->block;
+        size_t last = (first + loop->block < loop->count) ? first + loop->block : loop->count;
+        char * out = loop->out + loop->offsets[b] * loop->size;
+        for(size_t i = first; i < last; i++) {
+            if(!loop->keep[i]) continue;
+            memcpy(out, loop->data + i * loop->size, loop->size);
+            out += loop->size;
+        }
+    }
+}
+
+/**
+ * Run `fn` on every element of an array, on the shared pool (see `ra_parallel_pool()`). For updating big arrays in place, e.g. integrating an `RA_WECTANGLE` array's positions. Elements may be modified, but the array itself must not be (no appending or removing).
+ *
+ * @param ra The array.
+ * @param fn What to run on each element, given a pointer to it and its index. Runs on several threads at once.
+ * @param ctx Passed along to `fn`.
+ * @param grain The smallest number of elements worth handing to another thread; `0` to pick one. Raise it when `fn` is cheap.
+ */
+void ra_parallel_for(r_array * ra, void (* fn)(void * element, size_t idx, void * ctx), void * ctx, size_t grain) {
+    ra_internal_loop loop = { .data = ra->memory.root, .size = (size_t) abs(ra->type.size), .fn = (void *) fn, .ctx = ctx };
+    ra_pool_run(ra_parallel_pool(), ra->count, ra_internal_for_range, &loop, grain);
+}
+
+/**
+ * Map every element of one array into a new element at the end of another, in the same order, on the shared pool. `dst`'s space is reserved once up front, and each element is written in place. Overflow behaves like `ra_append_n()`.
+ *
+ * @param src The array to map from.
+ * @param dst The array to append to; may hold a different type than `src`, but not strings, and must not be `src`.
+ * @param fn What to run on each element, given a pointer to it, a pointer to its (uninitialized) slot in `dst` and its index. Runs on several threads at once.
+ * @param ctx Passed along to `fn`.
+ * @param grain See `ra_parallel_for()`.
+ * @return Pointer to the first element appended in `dst`, `NULL` if appending went wrong.
+ */
+void * ra_parallel_map(r_array * src, r_array * dst, void (* fn)(const void * in, void * out, size_t idx, void * ctx), void * ctx, size_t grain) {
+    if(dst->type.size < 0 || dst == src) {
+        #ifndef RA_SILENT
+        printf("ra_parallel_map: Can't map ra <%p> (%s) into ra <%p> (%s); the destination must hold a non-string type and be a different array!\n", src, src->type.typename, dst, dst->type.typename);
+        #endif
+        return NULL;
+    }
+
+    void * output = ra_internal_reserve_tail(dst, src->count * (size_t) dst->type.size, "ra_parallel_map");
+    if(output == NULL) return NULL;
+
+    ra_internal_loop loop = { .data = src->memory.root, .size = (size_t) abs(src->type.size), .out = output, .out_size = (size_t) dst->type.size, .fn = (void *) fn, .ctx = ctx };
+    ra_pool_run(ra_parallel_pool(), src->count, ra_internal_map_range, &loop, grain);
+
+    ra_internal_commit_tail(dst, src->count);
+    return output;
+}
+
+/**
+ * Keep only the elements of an array that `pred` accepts, in their original order, on the shared pool. The opposite of `ra_remove_if()`, in parallel: the array is cut into blocks, every element is tested and each block's kept elements counted, a prefix sum over the counts gives each block's place in the result, and the blocks are then compacted independently (through scratch memory) and copied back.
+ *
+ * @param ra The array to filter.
+ * @param pred Whether to keep an element. Runs on several threads at once.
+ * @param ctx Passed along to `pred`.
+ * @param grain The number of elements per block; `0` to pick one.
+ * @return The number of elements kept.
+ */
+size_t ra_parallel_filter(r_array * ra, bool (* pred)(const void * element, void * ctx), void * ctx, size_t grain) {
+    size_t count = ra->count;
+    size_t size = (size_t) abs(ra->type.size);
+    ra_pool * pool = ra_parallel_pool();
+
+    size_t block = grain;
+    if(block == 0) {
+        block = count / ((pool == NULL) ? 1 : pool->num_threads * 8);
+        if(block < 1024) block = 1024;
+    }
+    size_t num_blocks = (count + block - 1) / block;
+
+    ra_internal_loop loop = { .data = ra->memory.root, .count = count, .size = size, .fn = (void *) pred, .ctx = ctx, .block = block };
+    loop.keep = malloc(count + 1);
+    loop.offsets = malloc((num_blocks + 1) * sizeof(size_t));
+
+    if(loop.keep == NULL || loop.offsets == NULL) {
+        // no memory for the passes; compact on this thread like ra_remove_if()
+        free(loop.keep);
+        free(loop.offsets);
+
+        size_t kept = 0;
+        for(size_t i = 0; i < count; i++) {
+            if(!pred(loop.data + i * size, ctx)) continue;
+            if(kept != i) memcpy(loop.data + kept * size, loop.data + i * size, size);
+            kept++;
+        }
+        ra_truncate(ra, kept);
+        return kept;
+    }
+
+    // each block's count lands in the slot after it, so summing in place leaves each block's offset in its own slot
+    loop.offsets[0] = 0;
+    ra_pool_run(pool, num_blocks, ra_internal_filter_test_range, &loop, 1);
+    for(size_t b = 0; b < num_blocks; b++) loop.offsets[b + 1] += loop.offsets[b];
+    size_t kept = loop.offsets[num_blocks];
+
+    if(kept != count) {
+        loop.out = malloc(kept * size + 1);
+        if(loop.out != NULL) {
+            ra_pool_run(pool, num_blocks, ra_internal_filter_copy_range, &loop, 1);
+            memcpy(ra->memory.root, loop.out, kept * size);
+        } else {
+            // no scratch; compact on this thread from the flags
+            size_t to = 0;
+            for(size_t i = 0; i < count; i++) {
+                if(!loop.keep[i]) continue;
+                if(to != i) memcpy(loop.data + to * size, loop.data + i * size, size);
+                to++;
+            }
+        }
+        free(loop.out);
+        ra_truncate(ra, kept);
+    }
+
+    free(loop.keep);
+    free(loop.offsets);
+    return kept;
+}
+
+//------------------------------------------------------------------------------
+// SHARDS
+
+/**
+ * Make an empty sharded array. Must be destroyed with `ra_sharded_destroy()`.
+ *
+ * @param type_pair The type pair the shards hold.
+ * @param num_shards The number of shards, usually the number of threads filling it (see `ra_parallel_threads()`).
+ * @param capacity How many elements to make room for up front, **per shard**.
+ * @return The sharded array. If its shards couldn't be allocated, `num_shards` is zero.
+ */
+ra_sharded ra_sharded_create(ra_type type_pair, size_t num_shards, size_t capacity) {
+    ra_sharded output = { .shards = calloc(num_shards, sizeof(r_array)), .num_shards = num_shards, .type = type_pair };
+    if(output.shards == NULL) {
+        #ifndef RA_SILENT
+        printf("ra_sharded_create: Couldn't allocate %zu shards!\n", num_shards);
+        #endif
+        output.num_shards = 0;
+        return output;
+    }
+
+    // ra_type is const, so the shards can't be assigned
+    for(size_t i = 0; i < num_shards; i++) {
+        r_array shard = ra_create_growable(type_pair, capacity, RA_DEFAULT_GROWTH_FACTOR);
+        memcpy(&output.shards[i], &shard, sizeof(r_array));
+    }
+
+    return output;
+}
+
+/**
+ * Free a sharded array's memory, shards and all.
+ */
+void ra_sharded_destroy(ra_sharded * sharded) {
+    for(size_t i = 0; i < sharded->num_shards; i++) ra_destroy(&sharded->shards[i]);
+    free(sharded->shards);
+    sharded->shards = NULL;
+    sharded->num_shards = 0;
+}
+
+/**
+ * Get one of a sharded array's shards, to append to from one thread.
+ *
+ * @param sharded The sharded array.
+ * @param which The shard, usually the thread's number.
+ * @return The shard. If `which` is out of range, the program will crash. If `RA_NO_CRASH_ON_OVERFLOW` is defined, then this will return `NULL`.
+ */
+r_array * ra_shard(ra_sharded * sharded, size_t which) {
+    if(which >= sharded->num_shards) {
+        #ifndef RA_NO_CRASH_ON_OVERFLOW
+            // this print is not silenceable because it crashes, like ra_get()'s
+            printf("ra_shard: Attempted to access shard %zu of ra_sharded <%p>, which only has %zu shards.\n", which, sharded, sharded->num_shards);
+            exit(80085);
+        #else
+            #ifndef RA_SILENT
+            printf("ra_shard: (RA_NO_CRASH_ON_OVERFLOW) Attempted to access shard %zu of ra_sharded <%p>, which only has %zu shards.\n", which, sharded, sharded->num_shards);
+            #endif
+            return NULL;
+        #endif
+    }
+
+    return &sharded->shards[which];
+}
+
+/**
+ * Get the number of elements across all of a sharded array's shards.
+ */
+size_t ra_sharded_count(const ra_sharded * sharded) {
+    size_t count = 0;
+    for(size_t i = 0; i < sharded->num_shards; i++) count += sharded->shards[i].count;
+    return count;
+}
+
+/**
+ * Empty every shard, keeping their memory for the next round.
+ */
+void ra_sharded_clear(ra_sharded * sharded) {
+    for(size_t i = 0; i < sharded->num_shards; i++) ra_truncate(&sharded->shards[i], 0);
+}
+
+//------------------------------------------------------------------------------
+// GATHERING AND REDUCING
+
+/**
+ * Gather a sharded array into a new contiguous array, in shard order. See `ra_gather_into()`. Must be destroyed with `ra_destroy()`.
+ *
+ * @param sharded The sharded array.
+ * @param num_threads The number of pieces to split the copy into, run on the shared pool (see `ra_parallel_pool()`); `0` for `ra_parallel_threads()`.
+ * @return The gathered array, holding exactly the shards' elements.
+ */
+r_array ra_gather(ra_sharded * sharded, size_t num_threads) {
+    size_t count = ra_sharded_count(sharded);
+    r_array output = ra_create_growable(sharded->type, (count == 0) ? 1 : count, RA_DEFAULT_GROWTH_FACTOR);
+    ra_gather_into(sharded, &output, num_threads);
+    return output;
+}
+
+/**
+ * Append every shard of a sharded array to `dst`, in shard order. The space is reserved once; each shard's offset in it is a prefix sum of the counts before it, and the bytes are then split evenly into pieces, each `memcpy()`ing its range (which may span several shards, or part of one). Small gathers (see `RA_PARALLEL_MIN_BYTES`) stay on the calling thread. String arrays are appended one shard at a time on the calling thread, since each string is copied into `dst`'s pool. Overflow behaves like `ra_append_n()`.
+ *
+ * @param sharded The sharded array. Its shards are left as they were.
+ * @param dst The array to append to. Must hold the same type as `sharded`.
+ * @param num_threads The number of pieces to split the copy into, run on the shared pool (see `ra_parallel_pool()`); `0` for `ra_parallel_threads()`.
+ * @return Pointer to the first element appended in `dst`, `NULL` if appending went wrong (including mismatched types).
+ */
+void * ra_gather_into(ra_sharded * sharded, r_array * dst, size_t num_threads) {
+    if(strcmp(dst->type.typename, sharded->type.typename) != 0) {
+        #ifndef RA_SILENT
+        printf("ra_gather_into: Tried to gather ra_sharded <%p> (%s) into ra <%p> (%s), but their types don't match!\n", sharded, sharded->type.typename, dst, dst->type.typename);
+        #endif
+        return NULL;
+    }
+
+    if(dst->type.size < 0) {
+        void * output = NULL;
+        for(size_t i = 0; i < sharded->num_shards; i++) {
+            if(sharded->shards[i].count == 0) continue;
+            void * appended = ra_extend(dst, &sharded->shards[i]);
+            if(appended == NULL) return NULL;
+            if(output == NULL) output = appended;
+        }
+        return (output == NULL) ? dst->memory.position : output;
+    }
+
+    size_t * offsets = malloc((sharded->num_shards + 1) * sizeof(size_t));
+    if(offsets == NULL) return NULL;
+
+    offsets[0] = 0;
+    for(size_t i = 0; i < sharded->num_shards; i++) offsets[i + 1] = offsets[i] + sharded->shards[i].count * (size_t) dst->type.size;
+    size_t bytes = offsets[sharded->num_shards];
+
+    void * output = ra_internal_reserve_tail(dst, bytes, "ra_gather_into");
+    if(output == NULL) {
+        free(offsets);
+        return NULL;
+    }
+
+    if(num_threads == 0) num_threads = ra_parallel_threads();
+    if(bytes < RA_PARALLEL_MIN_BYTES) num_threads = 1;
+
+    ra_internal_gather_job * jobs = calloc(num_threads, sizeof(ra_internal_gather_job));
+    if(jobs == NULL) num_threads = 1;
+
+    if(num_threads == 1) {
+        ra_internal_gather_job job = { sharded, offsets, output, 0, bytes };
+        ra_internal_gather_thread(&job);
+    } else {
+        for(size_t t = 0; t < num_threads; t++) jobs[t] = (ra_internal_gather_job) { sharded, offsets, output, bytes * t / num_threads, bytes * (t + 1) / num_threads };
+        ra_internal_parallel_run(ra_internal_gather_thread, jobs, sizeof(ra_internal_gather_job), num_threads);
+    }
+
+    free(jobs);
+    free(offsets);
+
+    ra_internal_commit_tail(dst, bytes / (size_t) dst->type.size);
+    return output;
+}
+
+/**
+ * Sum a sharded array, or find its minimum or maximum, without gathering it. Each shard goes through the same SIMD kernel as `ra_view_sum()` (or `ra_view_minmax()`), the shards split into pieces; the per-shard results are then combined on the calling thread. Works for ints, doubles, `Vector2`s and `Vector3`s.
+ *
+ * @param sharded The sharded array.
+ * @param op What to compute. See `ra_reduce_op`.
+ * @param result Where to write the result: for sums, a `long long` for ints, otherwise the element type; for minima and maxima, the element type.
+ * @param num_threads The number of pieces to split the shards into, run on the shared pool (see `ra_parallel_pool()`); `0` for `ra_parallel_threads()`. Never more than one per shard.
+ * @return `false` (and nothing written) if the type isn't supported, or, for minima and maxima, if every shard is empty.
+ */
+bool ra_reduce(ra_sharded * sharded, ra_reduce_op op, void * result, size_t num_threads) {
+    int components;
+    ra_view probe = { .count = 0, .stride = abs(sharded->type.size), .typename = sharded->type.typename, .size = sharded->type.size };
+    ra_kernel kernel = ra_internal_kernel_for(probe, NULL, &components);
+    if(kernel == RA_KERNEL_NONE) return false;
+
+    ra_internal_reduce_part * parts = calloc(sharded->num_shards, sizeof(ra_internal_reduce_part));
+    if(parts == NULL) return false;
+    for(size_t i = 0; i < sharded->num_shards; i++) parts[i].view = ra_view_of(&sharded->shards[i]);
+
+    if(num_threads == 0) num_threads = ra_parallel_threads();
+    if(num_threads > sharded->num_shards) num_threads = sharded->num_shards;
+    if(ra_sharded_count(sharded) * (size_t) sharded->type.size < RA_PARALLEL_MIN_BYTES) num_threads = 1;
+
+    ra_internal_reduce_job * jobs = calloc(num_threads, sizeof(ra_internal_reduce_job));
+    if(jobs == NULL) {
+        ra_internal_reduce_job job = { parts, 0, 1, sharded->num_shards, op };
+        ra_internal_reduce_thread(&job);
+    } else {
+        for(size_t t = 0; t < num_threads; t++) jobs[t] = (ra_internal_reduce_job) { parts, t, num_threads, sharded->num_shards, op };
+        ra_internal_parallel_run(ra_internal_reduce_thread, jobs, sizeof(ra_internal_reduce_job), num_threads);
+    }
+    free(jobs);
+
+    ra_internal_reduce_part total = { 0 };
+    for(size_t i = 0; i < sharded->num_shards; i++) {
+        ra_internal_reduce_part * part = &parts[i];
+
+        if(op == RA_REDUCE_SUM) {
+            if(kernel == RA_KERNEL_INTS) total.sum.i += part->sum.i;
+            else if(kernel == RA_KERNEL_DOUBLES) total.sum.d += part->sum.d;
+            else for(int c = 0; c < components; c++) total.sum.f[c] += part->sum.f[c];
+            continue;
+        }
+
+        if(!part->any) continue;
+        if(!total.any) {
+            total.min = part->min;
+            total.max = part->max;
+            total.any = true;
+            continue;
+        }
+
+        if(kernel == RA_KERNEL_INTS) {
+            if(part->min.i < total.min.i) total.min.i = part->min.i;
+            if(part->max.i > total.max.i) total.max.i = part->max.i;
+        } else if(kernel == RA_KERNEL_DOUBLES) {
+            if(part->min.d < total.min.d) total.min.d = part->min.d;
+            if(part->max.d > total.max.d) total.max.d = part->max.d;
+        } else {
+            for(int c = 0; c < components; c++) {
+                if(part->min.f[c] < total.min.f[c]) total.min.f[c] = part->min.f[c];
+                if(part->max.f[c] > total.max.f[c]) total.max.f[c] = part->max.f[c];
+            }
+        }
+    }
+    free(parts);
+
+    if(op == RA_REDUCE_SUM) {
+        memcpy(result, &total.sum, (kernel == RA_KERNEL_INTS) ? sizeof(long long) : (size_t) sharded->type.size);
+        return true;
+    }
+
+    if(!total.any) return false;
+    memcpy(result, (op == RA_REDUCE_MIN) ? (void *) &total.min : (void *) &total.max, (size_t) sharded->type.size);
+    return true;
+}
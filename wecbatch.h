@@ -0,0 +1,270 @@
+//-----------------------------------------------------------------------------//
+// WECBATCH - draws lots of Wectangles (solid, outlined or textured from one   //
+// atlas) as quads in a single pass through rlgl, instead of a few raylib draw //
+// calls each. Written for and by wrzeczak 2026.                               //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#include <rlgl.h>
+
+#include "r_array.h" // for aa_arena, and wectangle3.h
+
+//------------------------------------------------------------------------------
+
+/**
+ * One corner of a quad in a WectangleBatch, as it goes to rlgl.
+ *
+ * @param position Where it is on screen.
+ * @param texcoord Where it is in the texture, normalized to `[0, 1]`.
+ * @param color The color (or tint) it's drawn with.
+ */
+typedef struct {
+    Vector2 position;
+    Vector2 texcoord;
+    Color color;
+} WecVertex;
+
+/**
+ * A stretch of consecutive quads in a WectangleBatch that share a texture, and so go to the GPU in one draw call.
+ *
+ * @param texture_id The texture's id, or `0` for rlgl's default (white) texture, which solid and outlined quads use.
+ * @param first The index of the run's first vertex.
+ * @param count The number of vertices in the run; four per quad.
+ */
+typedef struct {
+    unsigned int texture_id;
+    size_t first;
+    size_t count;
+} WecBatchRun;
+
+/**
+ * Quads waiting to be drawn. Fill it with the `WectangleBatchAdd...()` functions, draw it with `WectangleBatchDraw()`, and `WectangleBatchClear()` it for the next frame (or don't, and draw the same quads again). Quads are drawn in the order they were added; each change between solid and textured quads starts a new draw call, so add all of one kind together where the layering allows.
+ *
+ * The vertices are built on the CPU with no GPU involved, so they can be inspected (or drawn some other way) through `vertices.root`: `num_vertices` `WecVertex`s, four per quad, counter-clockwise on screen.
+ *
+ * @param atlas The texture that textured quads are cut from. Can be `(Texture2D) { 0 }` if the batch only draws solid and outlined quads.
+ * @param vertices `WecVertex`s, four per quad.
+ * @param num_vertices The number of vertices in `vertices`.
+ * @param runs `WecBatchRun`s, covering `vertices` in order.
+ * @param num_runs The number of runs in `runs`.
+ */
+typedef struct {
+    Texture2D atlas;
+    aa_arena vertices;
+    size_t num_vertices;
+    aa_arena runs;
+    size_t num_runs;
+} WectangleBatch;
+
+//------------------------------------------------------------------------------
+
+WectangleBatch WectangleBatchCreate(Texture2D atlas, size_t capacity);
+void WectangleBatchDestroy(WectangleBatch * batch);
+void WectangleBatchClear(WectangleBatch * batch);
+
+void WectangleBatchAdd(WectangleBatch * batch, Wectangle wec, Color color);
+void WectangleBatchAddBaked(WectangleBatch * batch, WecBaked baked, Color color);
+void WectangleBatchAddLines(WectangleBatch * batch, Wectangle wec, float lineThick, Color color);
+void WectangleBatchAddTex(WectangleBatch * batch, Wectangle wec, Rectangle source, Color tint);
+void WectangleBatchAddTexBaked(WectangleBatch * batch, WecBaked baked, Rectangle source, Color tint);
+
+void WectangleBatchDraw(WectangleBatch * batch);
+
+//------------------------------------------------------------------------------
+// INTERNALS
+
+// add a quad given its corners in Wectangle order (a, b, c, d; clockwise on screen unless `mirrored`), and the texture coordinates to match; emitted counter-clockwise, which is what rlgl doesn't cull
+void WecBatchPushQuad(WectangleBatch * batch, unsigned int texture_id, const Vector2 corners[4], const Vector2 texcoords[4], bool mirrored, Color color) {
+    WecBatchRun * last = (batch->num_runs == 0) ? NULL : ((WecBatchRun *) batch->runs.root) + (batch->num_runs - 1);
+    if(last != NULL && last->texture_id == texture_id) {
+        last->count += 4;
+    } else {
+        WecBatchRun run = { texture_id, batch->num_vertices, 4 };
+        if(aa_alloc(&batch->runs, &run, sizeof(WecBatchRun)) == NULL) return;
+        batch->num_runs++;
+    }
+
+    const int order[2][4] = { { 0, 3, 2, 1 }, { 0, 1, 2, 3 } };
+    for(int i = 0; i < 4; i++) {
+        int k = order[mirrored ? 1 : 0][i];
+        WecVertex vertex = { corners[k], texcoords[k], color };
+        if(aa_alloc(&batch->vertices, &vertex, sizeof(WecVertex)) == NULL) return;
+        batch->num_vertices++;
+    }
+}
+
+// whether a Wectangle's corners go counter-clockwise on screen, i.e. it's flipped by one negative dimension
+bool WecBatchMirrored(Wectangle wec) {
+    return (wec.width * wec.height) < 0.0f;
+}
+
+//------------------------------------------------------------------------------
+// CREATION
+
+/**
+ * Make an empty batch. Its memory grows as needed. Must be destroyed with `WectangleBatchDestroy()`.
+ *
+ * @param atlas The texture that textured quads are cut from, or `(Texture2D) { 0 }`. See `WectangleBatch`.
+ * @param capacity How many quads to make room for up front.
+ * @return The batch.
+ */
+WectangleBatch WectangleBatchCreate(Texture2D atlas, size_t capacity) {
+    return (WectangleBatch) {
+        .atlas = atlas,
+        .vertices = aa_create_growable((capacity + 1) * 4 * sizeof(WecVertex), RA_DEFAULT_GROWTH_FACTOR),
+        .runs = aa_create_growable(4 * sizeof(WecBatchRun), RA_DEFAULT_GROWTH_FACTOR)
+    };
+}
+
+/**
+ * Free a batch's memory. Doesn't unload the atlas.
+ */
+void WectangleBatchDestroy(WectangleBatch * batch) {
+    aa_destroy(batch->vertices);
+    aa_destroy(batch->runs);
+    batch->num_vertices = 0;
+    batch->num_runs = 0;
+}
+
+/**
+ * Empty a batch, keeping its memory for the next frame.
+ */
+void WectangleBatchClear(WectangleBatch * batch) {
+    batch->vertices.position = batch->vertices.root;
+    batch->runs.position = batch->runs.root;
+    batch->num_vertices = 0;
+    batch->num_runs = 0;
+}
+
+//------------------------------------------------------------------------------
+// ADDING QUADS
+
+/**
+ * Add a solid Wectangle to a batch. See `DrawWectangleWec()`.
+ *
+ * @param batch The batch in question.
+ * @param wec The Wectangle to draw.
+ * @param color The color to draw it in.
+ */
+void WectangleBatchAdd(WectangleBatch * batch, Wectangle wec, Color color) {
+    WectangleBatchAddBaked(batch, BakeWectangle(wec), color);
+}
+
+/**
+ * Add a solid baked Wectangle to a batch; no trig. See `WectangleBatchAdd()`.
+ */
+void WectangleBatchAddBaked(WectangleBatch * batch, WecBaked baked, Color color) {
+    Vector2 corners[4] = { baked.corners.a, baked.corners.b, baked.corners.c, baked.corners.d };
+    Vector2 texcoords[4] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
+    WecBatchPushQuad(batch, 0, corners, texcoords, WecBatchMirrored(baked.wec), color);
+}
+
+/**
+ * Add a Wectangle's outline to a batch, as four quads. The line is centered on the Wectangle's edge, like `DrawWectangleLinesEx()`, and the quads meet at the corners without overlapping, so translucent outlines come out even.
+ *
+ * @param batch The batch in question.
+ * @param wec The Wectangle to outline.
+ * @param lineThick The thickness of the line.
+ * @param color The color to draw it in.
+ */
+void WectangleBatchAddLines(WectangleBatch * batch, Wectangle wec, float lineThick, Color color) {
+    float sin_rot, cos_rot;
+    WectangleSinCos(wec, &sin_rot, &cos_rot);
+
+    // the outline's outside and inside edges, as Wectangles grown and shrunk by half the line on each side
+    Vector2 center = WectangleAxis(wec);
+    float sign_x = (wec.width < 0.0f) ? -1.0f : 1.0f;
+    float sign_y = (wec.height < 0.0f) ? -1.0f : 1.0f;
+    float inner_w = fmaxf(fabsf(wec.width) - lineThick, 0.0f);
+    float inner_h = fmaxf(fabsf(wec.height) - lineThick, 0.0f);
+    WecCorners outer = WecCornersOf(center, sign_x * (fabsf(wec.width) + lineThick), sign_y * (fabsf(wec.height) + lineThick), sin_rot, cos_rot);
+    WecCorners inner = WecCornersOf(center, sign_x * inner_w, sign_y * inner_h, sin_rot, cos_rot);
+
+    Vector2 out[4] = { outer.a, outer.b, outer.c, outer.d };
+    Vector2 in[4] = { inner.a, inner.b, inner.c, inner.d };
+    Vector2 texcoords[4] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
+    bool mirrored = WecBatchMirrored(wec);
+
+    for(int i = 0; i < 4; i++) {
+        int next = (i + 1) % 4;
+        Vector2 side[4] = { out[i], out[next], in[next], in[i] };
+        WecBatchPushQuad(batch, 0, side, texcoords, mirrored, color);
+    }
+}
+
+/**
+ * Add a textured Wectangle to a batch, cut from the batch's atlas. The source's top-left lands on the Wectangle's top-left (before rotation), as in `DrawWectangleTex()`; a negative source width or height flips it, as in `DrawTexturePro()`.
+ *
+ * @param batch The batch in question.
+ * @param wec The Wectangle to draw.
+ * @param source The part of the atlas to draw, in pixels.
+ * @param tint The color to tint it with; `WHITE` for none.
+ */
+void WectangleBatchAddTex(WectangleBatch * batch, Wectangle wec, Rectangle source, Color tint) {
+    WectangleBatchAddTexBaked(batch, BakeWectangle(wec), source, tint);
+}
+
+/**
+ * Add a textured baked Wectangle to a batch; no trig. See `WectangleBatchAddTex()`.
+ */
+void WectangleBatchAddTexBaked(WectangleBatch * batch, WecBaked baked, Rectangle source, Color tint) {
+    if(batch->atlas.id == 0 || batch->atlas.width == 0 || batch->atlas.height == 0) {
+        #ifndef RA_SILENT
+        printf("WectangleBatchAddTexBaked: batch <%p> has no atlas!\n", batch);
+        #endif
+        return;
+    }
+
+    float u0 = source.x / batch->atlas.width;
+    float v0 = source.y / batch->atlas.height;
+    float u1 = (source.x + fabsf(source.width)) / batch->atlas.width;
+    float v1 = (source.y + fabsf(source.height)) / batch->atlas.height;
+    if(source.width < 0.0f) {
+        float swap = u0;
+        u0 = u1;
+        u1 = swap;
+    }
+    if(source.height < 0.0f) {
+        float swap = v0;
+        v0 = v1;
+        v1 = swap;
+    }
+
+    Vector2 corners[4] = { baked.corners.a, baked.corners.b, baked.corners.c, baked.corners.d };
+    Vector2 texcoords[4] = { { u0, v0 }, { u1, v0 }, { u1, v1 }, { u0, v1 } };
+    WecBatchPushQuad(batch, batch->atlas.id, corners, texcoords, WecBatchMirrored(baked.wec), tint);
+}
+
+//------------------------------------------------------------------------------
+// DRAWING
+
+/**
+ * Draw everything in a batch. The vertices go into rlgl's render batch, which only issues a draw call when the texture changes (i.e. once per `WecBatchRun`) or it fills up. Doesn't clear the batch. Call between `BeginDrawing()` and `EndDrawing()`, like any raylib drawing.
+ *
+ * @param batch The batch to draw.
+ */
+void WectangleBatchDraw(WectangleBatch * batch) {
+    const WecVertex * vertices = (const WecVertex *) batch->vertices.root;
+    const WecBatchRun * runs = (const WecBatchRun *) batch->runs.root;
+
+    for(size_t r = 0; r < batch->num_runs; r++) {
+        rlSetTexture((runs[r].texture_id == 0) ? rlGetTextureIdDefault() : runs[r].texture_id);
+        rlBegin(RL_QUADS);
+        rlNormal3f(0.0f, 0.0f, 1.0f);
+
+        for(size_t i = runs[r].first; i < runs[r].first + runs[r].count; i += 4) {
+            // whole quads only; this flushes rlgl's buffer first if the quad wouldn't fit
+            rlCheckRenderBatchLimit(4);
+            for(size_t k = i; k < i + 4; k++) {
+                rlColor4ub(vertices[k].color.r, vertices[k].color.g, vertices[k].color.b, vertices[k].color.a);
+                rlTexCoord2f(vertices[k].texcoord.x, vertices[k].texcoord.y);
+                rlVertex2f(vertices[k].position.x, vertices[k].position.y);
+            }
+        }
+
+        rlEnd();
+    }
+
+    rlSetTexture(0);
+}
@@ -0,0 +1,561 @@
+//-----------------------------------------------------------------------------//
+// WECGRID - a uniform hash grid broad phase for Wectangles. Finds the pairs   //
+// worth handing to CheckCollisionWecs() without checking all n^2 of them.     //
+// Written for and by wrzeczak 2026.                                           //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#include "r_array.h" // for RA_WECTANGLE, RA_WECPAIR, and wectangle3.h
+
+//------------------------------------------------------------------------------
+
+/**
+ * Where a Wectangle is in a WecGrid.
+ *
+ * @param bounds The Wectangle's bounding box (see `WectangleBounds()`) when it was last put in the grid.
+ * @param x0, y0, x1, y1 The cells `bounds` covers, inclusive.
+ */
+typedef struct {
+    Rectangle bounds;
+    int x0, y0, x1, y1;
+} WecGridBody;
+
+/**
+ * One cell of a WecGrid. Cells are made the first time something lands in them, and stay (possibly empty) until `WecGridRebuild()` or `WecGridDestroy()`.
+ *
+ * @param x, y The cell's coordinates; the cell covers `[x * cell_size, (x + 1) * cell_size)`, likewise for y.
+ * @param used Whether this slot of the table holds a cell.
+ * @param bodies The indices of the Wectangles overlapping the cell, in no particular order.
+ */
+typedef struct {
+    int x, y;
+    bool used;
+    r_array_int bodies;
+} WecGridCell;
+
+/**
+ * A uniform grid over an `r_array` of `RA_WECTANGLE`, hashed so only the cells in use take memory. Each Wectangle is listed in every cell its bounding box touches, so two Wectangles can only collide if they share a cell.
+ *
+ * @param cell_size The side length of a cell. About the size of a typical Wectangle works well; much smaller and big Wectangles cover lots of cells, much bigger and cells hold lots of Wectangles.
+ * @param wecs The Wectangles. **Not owned**; the grid keeps the pointer, so the array has to outlive it.
+ * @param bodies One `WecGridBody` per Wectangle in the grid, in the same order as `wecs`.
+ * @param num_bodies The number of Wectangles in the grid.
+ * @param cells Open-addressed table of cells, `cell_capacity` slots long (a power of two).
+ * @param cell_capacity The number of slots in `cells`.
+ * @param cells_used The number of slots holding a cell.
+ * @param min_x, min_y, max_x, max_y The range of coordinates of the cells made so far (if any), so raycasts know where to stop.
+ */
+typedef struct {
+    float cell_size;
+    r_array * wecs;
+    aa_arena bodies;
+    size_t num_bodies;
+    WecGridCell * cells;
+    size_t cell_capacity;
+    size_t cells_used;
+    int min_x, min_y, max_x, max_y;
+} WecGrid;
+
+//------------------------------------------------------------------------------
+
+WecGrid WecGridCreate(r_array * wecs, float cell_size);
+void WecGridDestroy(WecGrid * grid);
+void WecGridRebuild(WecGrid * grid);
+
+void WecGridUpdate(WecGrid * grid, int idx);
+void WecGridMove(WecGrid * grid, int idx, Vector2 trans);
+
+size_t WecGridPairs(WecGrid * grid, r_array * out_pairs);
+size_t WecGridCollisions(WecGrid * grid, r_array * out_pairs);
+size_t WecGridQueryRec(WecGrid * grid, Rectangle area, r_array * out_indices);
+
+WecRayHit WecGridRaycast(WecGrid * grid, Vector2 origin, Vector2 direction, float max_distance, int * out_index);
+bool WecGridLineOfSight(WecGrid * grid, Vector2 from, Vector2 to);
+WecRayHit RaycastWectangles(r_array * wecs, Vector2 origin, Vector2 direction, float max_distance, int * out_index);
+
+//------------------------------------------------------------------------------
+// INTERNALS
+
+WecGridBody * WecGridGetBody(WecGrid * grid, int idx) {
+    return ((WecGridBody *) grid->bodies.root) + idx;
+}
+
+// the cells a bounding box covers
+WecGridBody WecGridBodyOf(WecGrid * grid, Wectangle wec) {
+    Rectangle bounds = WectangleBounds(wec);
+    return (WecGridBody) {
+        .bounds = bounds,
+        .x0 = (int) floorf(bounds.x / grid->cell_size),
+        .y0 = (int) floorf(bounds.y / grid->cell_size),
+        .x1 = (int) floorf((bounds.x + bounds.width) / grid->cell_size),
+        .y1 = (int) floorf((bounds.y + bounds.height) / grid->cell_size)
+    };
+}
+
+size_t WecGridHash(int x, int y) {
+    return ((size_t) (unsigned int) x * 73856093u) ^ ((size_t) (unsigned int) y * 19349663u);
+}
+
+// the slot holding cell (x, y), or the empty slot where it would go
+size_t WecGridProbe(WecGridCell * cells, size_t capacity, int x, int y) {
+    size_t mask = capacity - 1;
+    size_t i = WecGridHash(x, y) & mask;
+    while(cells[i].used && (cells[i].x != x || cells[i].y != y)) i = (i + 1) & mask;
+    return i;
+}
+
+// keep the load factor at or under 1/2
+void WecGridGrowCells(WecGrid * grid) {
+    if(grid->cells != NULL && (grid->cells_used + 1) * 2 <= grid->cell_capacity) return;
+
+    size_t capacity = (grid->cell_capacity == 0) ? 64 : grid->cell_capacity * 2;
+    WecGridCell * cells = calloc(capacity, sizeof(WecGridCell));
+    if(cells == NULL) {
+        printf("WecGridGrowCells: Failed to allocate %zu cells!\n", capacity);
+        exit(80085);
+    }
+
+    for(size_t i = 0; i < grid->cell_capacity; i++) {
+        if(grid->cells[i].used) memcpy(&cells[WecGridProbe(cells, capacity, grid->cells[i].x, grid->cells[i].y)], &grid->cells[i], sizeof(WecGridCell));
+    }
+
+    free(grid->cells);
+    grid->cells = cells;
+    grid->cell_capacity = capacity;
+}
+
+WecGridCell * WecGridGetCell(WecGrid * grid, int x, int y) {
+    WecGridGrowCells(grid);
+
+    WecGridCell * cell = &grid->cells[WecGridProbe(grid->cells, grid->cell_capacity, x, y)];
+    if(!cell->used) {
+        WecGridCell made = { .x = x, .y = y, .used = true, .bodies = ra_create_growable_int(4, RA_DEFAULT_GROWTH_FACTOR) };
+        memcpy(cell, &made, sizeof(WecGridCell)); // r_array has a const member, so no plain assignment
+
+        if(grid->cells_used == 0 || x < grid->min_x) grid->min_x = x;
+        if(grid->cells_used == 0 || y < grid->min_y) grid->min_y = y;
+        if(grid->cells_used == 0 || x > grid->max_x) grid->max_x = x;
+        if(grid->cells_used == 0 || y > grid->max_y) grid->max_y = y;
+        grid->cells_used++;
+    }
+    return cell;
+}
+
+void WecGridInsertRange(WecGrid * grid, int idx, int x0, int y0, int x1, int y1) {
+    for(int y = y0; y <= y1; y++) {
+        for(int x = x0; x <= x1; x++) ra_append_int(&WecGridGetCell(grid, x, y)->bodies, idx);
+    }
+}
+
+// remove `idx` from the cells in the range that aren't also in `keep` (pass an empty range to remove from all of them)
+void WecGridRemoveRange(WecGrid * grid, int idx, WecGridBody from, WecGridBody keep) {
+    for(int y = from.y0; y <= from.y1; y++) {
+        for(int x = from.x0; x <= from.x1; x++) {
+            if(x >= keep.x0 && x <= keep.x1 && y >= keep.y0 && y <= keep.y1) continue;
+
+            WecGridCell * cell = WecGridGetCell(grid, x, y);
+            int at = ra_member_at_int(&cell->bodies, idx);
+            if(at >= 0) ra_swap_remove_int(&cell->bodies, at);
+        }
+    }
+}
+
+// put the next Wectangle in the array (index `num_bodies`) in the grid
+void WecGridAdd(WecGrid * grid) {
+    int idx = (int) grid->num_bodies;
+    WecGridBody body = WecGridBodyOf(grid, *(Wectangle *) ra_get_unsafe(grid->wecs, idx));
+
+    aa_alloc(&grid->bodies, &body, sizeof(WecGridBody));
+    grid->num_bodies++;
+    WecGridInsertRange(grid, idx, body.x0, body.y0, body.x1, body.y1);
+}
+
+// pick up Wectangles appended to (or removed from) `wecs` since the grid last looked
+void WecGridSync(WecGrid * grid) {
+    if(grid->wecs->count < grid->num_bodies) {
+        WecGridRebuild(grid);
+        return;
+    }
+
+    while(grid->num_bodies < grid->wecs->count) WecGridAdd(grid);
+}
+
+// the stretch [*enter, *exit] of a ray (unit `direction`) inside a rectangle; false if it misses
+bool WecGridRayBox(Vector2 origin, Vector2 direction, Rectangle box, float * enter, float * exit) {
+    float from[2] = { origin.x, origin.y };
+    float toward[2] = { direction.x, direction.y };
+    float lo[2] = { box.x, box.y };
+    float hi[2] = { box.x + box.width, box.y + box.height };
+
+    *enter = -INFINITY;
+    *exit = INFINITY;
+    for(int k = 0; k < 2; k++) {
+        if(toward[k] == 0.0f) {
+            if(from[k] < lo[k] || from[k] > hi[k]) return false;
+            continue;
+        }
+
+        float t0 = (lo[k] - from[k]) / toward[k];
+        float t1 = (hi[k] - from[k]) / toward[k];
+        *enter = fmaxf(*enter, fminf(t0, t1));
+        *exit = fminf(*exit, fmaxf(t0, t1));
+    }
+
+    return *enter <= *exit;
+}
+
+// walk the cells along a ray (unit `direction`) nearest first, testing what's in them; stops at the first hit if `any`, otherwise once no later cell can hold a nearer one
+WecRayHit WecGridCast(WecGrid * grid, Vector2 origin, Vector2 direction, float max_distance, bool any, int * out_index) {
+    WecRayHit best = { 0 };
+    WecGridSync(grid);
+    if(grid->cells_used == 0) return best;
+
+    // the grid is sparse, so clip the ray to the cells that exist; past them there's nothing to hit
+    float size = grid->cell_size;
+    Rectangle extent = { grid->min_x * size, grid->min_y * size, (grid->max_x - grid->min_x + 1) * size, (grid->max_y - grid->min_y + 1) * size };
+    float enter, exit;
+    if(!WecGridRayBox(origin, direction, extent, &enter, &exit)) return best;
+
+    float start = fmaxf(enter, 0.0f);
+    float end = fminf(exit, max_distance);
+    if(start > end) return best;
+
+    Vector2 entry = Vector2Add(origin, Vector2Scale(direction, start));
+    int x = (int) Clamp(floorf(entry.x / size), grid->min_x, grid->max_x);
+    int y = (int) Clamp(floorf(entry.y / size), grid->min_y, grid->max_y);
+
+    // Amanatides-Woo: how far along the ray the next vertical and horizontal cell borders are, and how far apart
+    int step_x = (direction.x > 0.0f) ? 1 : -1;
+    int step_y = (direction.y > 0.0f) ? 1 : -1;
+    float next_x = (direction.x == 0.0f) ? INFINITY : (((x + (step_x > 0)) * size) - origin.x) / direction.x;
+    float next_y = (direction.y == 0.0f) ? INFINITY : (((y + (step_y > 0)) * size) - origin.y) / direction.y;
+    float delta_x = (direction.x == 0.0f) ? INFINITY : size / fabsf(direction.x);
+    float delta_y = (direction.y == 0.0f) ? INFINITY : size / fabsf(direction.y);
+
+    float limit = max_distance;
+    while(x >= grid->min_x && x <= grid->max_x && y >= grid->min_y && y <= grid->max_y) {
+        WecGridCell * cell = &grid->cells[WecGridProbe(grid->cells, grid->cell_capacity, x, y)];
+        if(cell->used) {
+            int * ids = (int *) cell->bodies.ra.memory.root;
+            for(size_t i = 0; i < cell->bodies.ra.count; i++) {
+                // Wectangles spanning several cells come up more than once; the bounding box weeds out most repeats and misses before any trig
+                float box_enter, box_exit;
+                if(!WecGridRayBox(origin, direction, WecGridGetBody(grid, ids[i])->bounds, &box_enter, &box_exit) || box_exit < 0.0f || box_enter > limit) continue;
+
+                WecRayHit hit = RaycastWectangle(origin, direction, limit, *(Wectangle *) ra_get_unsafe(grid->wecs, ids[i]));
+                if(!hit.hit || (best.hit && hit.distance >= best.distance)) continue;
+
+                best = hit;
+                limit = hit.distance;
+                if(out_index != NULL) *out_index = ids[i];
+                if(any) return best;
+            }
+        }
+
+        // a hit before the end of this cell can't be beaten by anything in a later one
+        float cell_exit = fminf(next_x, next_y);
+        if((best.hit && best.distance <= cell_exit) || cell_exit > end) break;
+
+        if(next_x < next_y) {
+            x += step_x;
+            next_x += delta_x;
+        } else {
+            y += step_y;
+            next_y += delta_y;
+        }
+    }
+
+    return best;
+}
+
+// append the pairs a cell (or empty slot) is responsible for to `out_pairs`; with `baked` (every Wectangle, baked), only the ones that actually collide. Reads the grid only, so cells can be done in parallel
+size_t WecGridCellPairs(WecGrid * grid, WecGridCell * cell, const WecBaked * baked, r_array * out_pairs) {
+    if(!cell->used || cell->bodies.ra.count < 2) return 0;
+
+    size_t found = 0;
+    int * ids = (int *) cell->bodies.ra.memory.root;
+    size_t count = cell->bodies.ra.count;
+    for(size_t i = 0; i < count; i++) {
+        WecGridBody * a = WecGridGetBody(grid, ids[i]);
+        for(size_t j = i + 1; j < count; j++) {
+            WecGridBody * b = WecGridGetBody(grid, ids[j]);
+
+            // a pair shows up in every cell the two share; only report it from the top-left one
+            if(((a->x0 > b->x0) ? a->x0 : b->x0) != cell->x || ((a->y0 > b->y0) ? a->y0 : b->y0) != cell->y) continue;
+            if(!CheckCollisionRecs(a->bounds, b->bounds)) continue;
+            if(baked != NULL && !CheckCollisionWecsBaked(baked[ids[i]], baked[ids[j]])) continue;
+
+            WecPair pair = (ids[i] < ids[j]) ? (WecPair) { ids[i], ids[j] } : (WecPair) { ids[j], ids[i] };
+            ra_append_n(out_pairs, &pair, 1);
+            found++;
+        }
+    }
+
+    return found;
+}
+
+bool WecGridCheckPairs(r_array * out_pairs, const char * caller) {
+    if(strcmp(out_pairs->type.typename, "WecPair") == 0) return true;
+
+    #ifndef RA_SILENT
+    printf("%s: out_pairs <%p> holds %s, not WecPair!\n", caller, out_pairs, out_pairs->type.typename);
+    #endif
+    return false;
+}
+
+//------------------------------------------------------------------------------
+// CREATION AND UPDATES
+
+/**
+ * Make a grid over an array of Wectangles, and put all of them in it. Must be destroyed with `WecGridDestroy()`.
+ *
+ * @param wecs The Wectangles (`RA_WECTANGLE`). The grid keeps this pointer, so the array has to outlive it; growing the array is fine.
+ * @param cell_size The side length of a cell; see `WecGrid`.
+ * @return The grid.
+ */
+WecGrid WecGridCreate(r_array * wecs, float cell_size) {
+    WecGrid grid = {
+        .cell_size = cell_size,
+        .wecs = wecs,
+        .bodies = aa_create_growable((wecs->count + 1) * sizeof(WecGridBody), RA_DEFAULT_GROWTH_FACTOR)
+    };
+
+    WecGridSync(&grid);
+    return grid;
+}
+
+/**
+ * Free a grid's memory. The Wectangle array isn't touched.
+ */
+void WecGridDestroy(WecGrid * grid) {
+    for(size_t i = 0; i < grid->cell_capacity; i++) {
+        if(grid->cells[i].used) ra_destroy_int(&grid->cells[i].bodies);
+    }
+    free(grid->cells);
+    aa_destroy(grid->bodies);
+
+    grid->cells = NULL;
+    grid->cell_capacity = 0;
+    grid->cells_used = 0;
+    grid->num_bodies = 0;
+}
+
+/**
+ * Empty the grid (freeing its cells) and put every Wectangle back in. Cheaper than lots of `WecGridUpdate()`s when most Wectangles moved, and needed after removing Wectangles from the array, since that changes their indices.
+ */
+void WecGridRebuild(WecGrid * grid) {
+    for(size_t i = 0; i < grid->cell_capacity; i++) {
+        if(grid->cells[i].used) ra_destroy_int(&grid->cells[i].bodies);
+    }
+    free(grid->cells);
+
+    grid->cells = NULL;
+    grid->cell_capacity = 0;
+    grid->cells_used = 0;
+    grid->num_bodies = 0;
+    grid->bodies.position = grid->bodies.root;
+
+    WecGridSync(grid);
+}
+
+/**
+ * Tell the grid a Wectangle changed (moved, rotated, resized). Only the cells it left or entered are touched, so a Wectangle moving within its cells costs one `WectangleBounds()`. An index past the ones in the grid adds the newly appended Wectangles up to and including it.
+ *
+ * @param grid The grid in question.
+ * @param idx The index of the Wectangle in the grid's array.
+ */
+void WecGridUpdate(WecGrid * grid, int idx) {
+    Wectangle * wec = ra_get(grid->wecs, idx);
+    if(wec == NULL) return;
+
+    if((size_t) idx >= grid->num_bodies) {
+        while(grid->num_bodies <= (size_t) idx) WecGridAdd(grid);
+        return;
+    }
+
+    WecGridBody next = WecGridBodyOf(grid, *wec);
+
+    WecGridBody * body = WecGridGetBody(grid, idx);
+    WecGridBody prev = *body;
+    *body = next;
+
+    if(prev.x0 == next.x0 && prev.y0 == next.y0 && prev.x1 == next.x1 && prev.y1 == next.y1) return;
+
+    WecGridRemoveRange(grid, idx, prev, next);
+    for(int y = next.y0; y <= next.y1; y++) {
+        for(int x = next.x0; x <= next.x1; x++) {
+            if(x >= prev.x0 && x <= prev.x1 && y >= prev.y0 && y <= prev.y1) continue;
+            ra_append_int(&WecGridGetCell(grid, x, y)->bodies, idx);
+        }
+    }
+}
+
+/**
+ * Move a Wectangle with `TranslateWectangle()` and update the grid.
+ *
+ * @param grid The grid in question.
+ * @param idx The index of the Wectangle in the grid's array.
+ * @param trans The amount to move it.
+ */
+void WecGridMove(WecGrid * grid, int idx, Vector2 trans) {
+    Wectangle * wec = ra_get(grid->wecs, idx);
+    if(wec == NULL) return;
+
+    *wec = TranslateWectangle(*wec, trans);
+    WecGridUpdate(grid, idx);
+}
+
+//------------------------------------------------------------------------------
+// QUERIES
+
+/**
+ * Find the pairs of Wectangles whose bounding boxes overlap. Every colliding pair is among these, so running `CheckCollisionWecs()` on them (or calling `WecGridCollisions()`) finds every collision. Wectangles appended to the array since the last call are picked up first.
+ *
+ * @param grid The grid in question.
+ * @param out_pairs An `RA_WECPAIR` array; the pairs are appended, each once, with `a < b`, in no particular order.
+ * @return The number of pairs appended.
+ */
+size_t WecGridPairs(WecGrid * grid, r_array * out_pairs) {
+    if(!WecGridCheckPairs(out_pairs, "WecGridPairs")) return 0;
+    WecGridSync(grid);
+
+    size_t found = 0;
+    for(size_t c = 0; c < grid->cell_capacity; c++) found += WecGridCellPairs(grid, &grid->cells[c], NULL, out_pairs);
+    return found;
+}
+
+/**
+ * Find the pairs of Wectangles that collide: `WecGridPairs()`, filtered with `CheckCollisionWecs()`.
+ *
+ * @param grid The grid in question.
+ * @param out_pairs An `RA_WECPAIR` array; the colliding pairs are appended, with `a < b`, in no particular order.
+ * @return The number of pairs appended.
+ */
+size_t WecGridCollisions(WecGrid * grid, r_array * out_pairs) {
+    size_t start = out_pairs->count;
+    if(WecGridPairs(grid, out_pairs) == 0) return 0;
+
+    WecPair * pairs = (WecPair *) out_pairs->memory.root;
+    size_t kept = start;
+    for(size_t i = start; i < out_pairs->count; i++) {
+        Wectangle a = *(Wectangle *) ra_get_unsafe(grid->wecs, pairs[i].a);
+        Wectangle b = *(Wectangle *) ra_get_unsafe(grid->wecs, pairs[i].b);
+        if(CheckCollisionWecs(a, b)) pairs[kept++] = pairs[i];
+    }
+
+    ra_truncate(out_pairs, kept);
+    return kept - start;
+}
+
+/**
+ * Find the Wectangles whose bounding boxes overlap a Rectangle, e.g. to run `CheckCollisionWecRec()` on.
+ *
+ * @param grid The grid in question.
+ * @param area The Rectangle in question.
+ * @param out_indices An `RA_INT` array; the indices are appended, each once, in no particular order.
+ * @return The number of indices appended.
+ */
+size_t WecGridQueryRec(WecGrid * grid, Rectangle area, r_array * out_indices) {
+    WecGridSync(grid);
+    if(grid->cells_used == 0) return 0;
+
+    int x0 = (int) floorf(area.x / grid->cell_size);
+    int y0 = (int) floorf(area.y / grid->cell_size);
+    int x1 = (int) floorf((area.x + area.width) / grid->cell_size);
+    int y1 = (int) floorf((area.y + area.height) / grid->cell_size);
+
+    size_t found = 0;
+    for(int y = y0; y <= y1; y++) {
+        for(int x = x0; x <= x1; x++) {
+            WecGridCell * cell = &grid->cells[WecGridProbe(grid->cells, grid->cell_capacity, x, y)];
+            if(!cell->used) continue;
+
+            int * ids = (int *) cell->bodies.ra.memory.root;
+            for(size_t i = 0; i < cell->bodies.ra.count; i++) {
+                WecGridBody * body = WecGridGetBody(grid, ids[i]);
+
+                // likewise, only report a Wectangle from the top-left cell it shares with the area
+                if(((body->x0 > x0) ? body->x0 : x0) != x || ((body->y0 > y0) ? body->y0 : y0) != y) continue;
+                if(!CheckCollisionRecs(body->bounds, area)) continue;
+
+                ra_append_n(out_indices, &ids[i], 1);
+                found++;
+            }
+        }
+    }
+
+    return found;
+}
+
+//------------------------------------------------------------------------------
+// RAYCASTING
+
+/**
+ * Cast a ray through the grid and find the nearest Wectangle it hits. Only the cells along the ray are visited, nearest first, and the walk stops as soon as nothing further along could be nearer, so a short ray through a big crowd is cheap. See `RaycastWectangle()`.
+ *
+ * @param grid The grid in question.
+ * @param origin Where the ray starts.
+ * @param direction Which way it goes; needn't be a unit vector.
+ * @param max_distance How far it goes; `INFINITY` for no limit.
+ * @param out_index If not `NULL`, gets the index of the Wectangle hit; untouched if nothing is.
+ * @return See `WecRayHit`.
+ */
+WecRayHit WecGridRaycast(WecGrid * grid, Vector2 origin, Vector2 direction, float max_distance, int * out_index) {
+    float length = Vector2Length(direction);
+    if(length == 0.0f) return (WecRayHit) { 0 };
+
+    return WecGridCast(grid, origin, Vector2Scale(direction, 1.0f / length), max_distance, false, out_index);
+}
+
+/**
+ * Check whether the segment between two points is clear of every Wectangle in the grid, e.g. for AI visibility. Stops at the first Wectangle in the way, nearest or not. Wectangles containing `from` don't count, like in `RaycastWectangle()`.
+ *
+ * @param grid The grid in question.
+ * @param from, to The ends of the segment.
+ * @return Whether nothing is in the way.
+ */
+bool WecGridLineOfSight(WecGrid * grid, Vector2 from, Vector2 to) {
+    Vector2 between = Vector2Subtract(to, from);
+    float length = Vector2Length(between);
+    if(length == 0.0f) return true;
+
+    return !WecGridCast(grid, from, Vector2Scale(between, 1.0f / length), length, true, NULL).hit;
+}
+
+/**
+ * Cast a ray at every Wectangle in an array and find the nearest one it hits, without a grid. Wectangles whose bounding circle is off the ray, or further along it than the nearest hit so far, are skipped before any trig. Fine for a few hundred Wectangles; beyond that, see `WecGridRaycast()`.
+ *
+ * @param wecs The Wectangles (`RA_WECTANGLE`).
+ * @param origin Where the ray starts.
+ * @param direction Which way it goes; needn't be a unit vector.
+ * @param max_distance How far it goes; `INFINITY` for no limit.
+ * @param out_index If not `NULL`, gets the index of the Wectangle hit; untouched if nothing is.
+ * @return See `WecRayHit`.
+ */
+WecRayHit RaycastWectangles(r_array * wecs, Vector2 origin, Vector2 direction, float max_distance, int * out_index) {
+    WecRayHit best = { 0 };
+    float length = Vector2Length(direction);
+    if(length == 0.0f || strcmp(wecs->type.typename, "Wectangle") != 0) return best;
+    direction = Vector2Scale(direction, 1.0f / length);
+
+    const Wectangle * data = (const Wectangle *) wecs->memory.root;
+    float limit = max_distance;
+    for(size_t i = 0; i < wecs->count; i++) {
+        // the bounding circle: how far along the ray its center is, and how far off it
+        float radius = WectangleChord(data[i]);
+        Vector2 to_center = Vector2Subtract(WectangleAxis(data[i]), origin);
+        float along = Vector2DotProduct(to_center, direction);
+        float off = direction.x * to_center.y - direction.y * to_center.x;
+        if(along + radius < 0.0f || along - radius > limit || fabsf(off) >= radius) continue;
+
+        WecRayHit hit = RaycastWectangle(origin, direction, limit, data[i]);
+        if(!hit.hit || (best.hit && hit.distance >= best.distance)) continue;
+
+        best = hit;
+        limit = hit.distance;
+        if(out_index != NULL) *out_index = (int) i;
+    }
+
+    return best;
+}
@@ -0,0 +1,130 @@
+//-----------------------------------------------------------------------------//
+// WECPARALLEL - the whole-array Wectangle passes, run on ra_parallel.h's      //
+// thread pool. Same results on any number of threads.                         //
+// Written for and by wrzeczak 2026.                                           //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#include "ra_parallel.h"
+#include "wecgrid.h"
+
+// how many pieces per pool thread the grid's cells are cut into, so a few crowded cells don't leave the other threads idle
+#ifndef WEC_COLLIDE_CHUNKS_PER_THREAD
+    #define WEC_COLLIDE_CHUNKS_PER_THREAD 8
+#endif
+
+//------------------------------------------------------------------------------
+
+size_t CollideAll(r_array * wecs, r_array * out_pairs);
+size_t WecGridCollideAll(WecGrid * grid, r_array * out_pairs);
+WecBaked * BakeWectangles(r_array * wecs);
+
+//------------------------------------------------------------------------------
+// INTERNALS
+
+// what the parallel passes' ranges need
+typedef struct {
+    const Wectangle * wecs;
+    WecBaked * baked;
+    WecGrid * grid;
+    ra_sharded * found; // one shard per chunk of cells
+    size_t num_chunks;
+} WecParallelJob;
+
+void WecParallelBakeRange(size_t begin, size_t end, void * ctx) {
+    WecParallelJob * job = ctx;
+    for(size_t i = begin; i < end; i++) job->baked[i] = BakeWectangle(job->wecs[i]);
+}
+
+// the broad and narrow phase together, for chunks [begin, end) of the grid's cell table; each chunk appends to its own shard
+void WecParallelCollideRange(size_t begin, size_t end, void * ctx) {
+    WecParallelJob * job = ctx;
+    for(size_t chunk = begin; chunk < end; chunk++) {
+        size_t first = job->grid->cell_capacity * chunk / job->num_chunks;
+        size_t last = job->grid->cell_capacity * (chunk + 1) / job->num_chunks;
+        for(size_t c = first; c < last; c++) WecGridCellPairs(job->grid, &job->grid->cells[c], job->baked, &job->found->shards[chunk]);
+    }
+}
+
+//------------------------------------------------------------------------------
+// PASSES
+
+/**
+ * Bake every Wectangle in an array (see `BakeWectangle()`), on the shared pool (see `ra_parallel_pool()`).
+ *
+ * @param wecs The Wectangles (`RA_WECTANGLE`).
+ * @return `wecs->count` baked Wectangles, in the same order; free with `free()`. `NULL` if they couldn't be allocated.
+ */
+WecBaked * BakeWectangles(r_array * wecs) {
+    WecBaked * baked = malloc((wecs->count + 1) * sizeof(WecBaked));
+    if(baked == NULL) return NULL;
+
+    WecParallelJob job = { .wecs = (const Wectangle *) wecs->memory.root, .baked = baked };
+    ra_pool_run(ra_parallel_pool(), wecs->count, WecParallelBakeRange, &job, 0);
+    return baked;
+}
+
+/**
+ * Find every pair of colliding Wectangles in a grid, on the shared pool (see `ra_parallel_pool()`). The Wectangles are baked in parallel first, so the narrow phase (`CheckCollisionWecsBaked()`) does no trig; then the grid's cells are cut into chunks, each chunk collecting its pairs (broad and narrow phase at once) into a shard of its own, with nothing shared between threads but the grid, read-only. The shards are gathered and sorted, so the result doesn't depend on the number of threads, or on which thread ran what.
+ *
+ * The pairs are the same ones `WecGridCollisions()` finds. For contact details, pass them to `GetManifoldWecs()` or `GetCollisionWecsInto()`, which are safe to run in parallel too (unlike `GetCollisionWecs()`).
+ *
+ * @param grid The grid in question. Wectangles appended to its array since the last call are picked up first.
+ * @param out_pairs An `RA_WECPAIR` array; the colliding pairs are appended, with `a < b`, sorted by `a`, then `b` (see `WecPairLess()`).
+ * @return The number of pairs appended.
+ */
+size_t WecGridCollideAll(WecGrid * grid, r_array * out_pairs) {
+    if(!WecGridCheckPairs(out_pairs, "WecGridCollideAll")) return 0;
+    WecGridSync(grid);
+    if(grid->cells_used == 0) return 0;
+
+    WecBaked * baked = BakeWectangles(grid->wecs);
+    if(baked == NULL) return 0;
+
+    ra_pool * pool = ra_parallel_pool();
+    size_t num_chunks = ((pool == NULL) ? 1 : pool->num_threads) * WEC_COLLIDE_CHUNKS_PER_THREAD;
+    if(num_chunks > grid->cell_capacity) num_chunks = grid->cell_capacity;
+
+    ra_sharded found = ra_sharded_create(RA_WECPAIR, num_chunks, 16);
+    WecParallelJob job = { .baked = baked, .grid = grid, .found = &found, .num_chunks = found.num_shards };
+    ra_pool_run(pool, job.num_chunks, WecParallelCollideRange, &job, 1);
+    free(baked);
+
+    // gathering in chunk order is already the same on any number of threads; sorting makes it easy to use, too
+    r_array pairs = ra_gather(&found, 0);
+    ra_sharded_destroy(&found);
+    ra_sort(&pairs);
+
+    size_t count = pairs.count;
+    if(count > 0 && ra_extend(out_pairs, &pairs) == NULL) count = 0;
+    ra_destroy(&pairs);
+    return count;
+}
+
+/**
+ * Find every pair of colliding Wectangles in an array, in parallel, without a grid of your own: a temporary `WecGrid`, with cells about the size of an average Wectangle, then `WecGridCollideAll()`. Keep a grid around instead if the Wectangles mostly stay put between calls.
+ *
+ * @param wecs The Wectangles (`RA_WECTANGLE`).
+ * @param out_pairs An `RA_WECPAIR` array; the colliding pairs are appended, with `a < b`, sorted. See `WecGridCollideAll()`.
+ * @return The number of pairs appended.
+ */
+size_t CollideAll(r_array * wecs, r_array * out_pairs) {
+    if(!WecGridCheckPairs(out_pairs, "CollideAll")) return 0;
+    if(wecs->count < 2) return 0;
+
+    const Wectangle * data = (const Wectangle *) wecs->memory.root;
+    double total = 0.0;
+    for(size_t i = 0; i < wecs->count; i++) {
+        float w = fabsf(data[i].width);
+        float h = fabsf(data[i].height);
+        total += (w > h) ? w : h;
+    }
+    float cell_size = (float) (total / (double) wecs->count);
+    if(!(cell_size > 0.0f)) cell_size = 1.0f;
+
+    WecGrid grid = WecGridCreate(wecs, cell_size);
+    size_t count = WecGridCollideAll(&grid, out_pairs);
+    WecGridDestroy(&grid);
+    return count;
+}
@@ -0,0 +1,453 @@
+//-----------------------------------------------------------------------------//
+// WECSOA - Wectangles stored structure-of-arrays, with kernels that work on   //
+// all of them at once, a SIMD register's worth at a time.                     //
+// Written for and by wrzeczak 2026.                                           //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#include "r_array.h" // for RA_F32, RA_WECTANGLE, RA_WECPAIR, and wectangle3.h
+
+//------------------------------------------------------------------------------
+
+/**
+ * Lots of Wectangles, one `r_array_float` per field instead of one array of `Wectangle`s, so the kernels below (`WecSoABounds()` etc.) can load a SIMD register's worth of each field at once (see `RA_NO_SIMD`). The sine and cosine of every rotation are kept alongside, so nothing here calls `sinf()`/`cosf()` per query.
+ *
+ * Every column is an ordinary contiguous `r_array_float` with the same count, so `x`, `y`, `width` and `height` can be written in place through `(float *) soa.x.ra.memory.root`, e.g. to integrate velocities. Rotations can't (the sines and cosines would go stale): use `WecSoASet()`, or call `WecSoARebake()` after writing `rot`.
+ *
+ * @param x, y, width, height, rot The Wectangles' fields. See `Wectangle`.
+ * @param sin_rot, cos_rot The sine and cosine of each `rot`. See `WectangleSinCos()`.
+ */
+typedef struct {
+    r_array_float x, y, width, height, rot;
+    r_array_float sin_rot, cos_rot;
+} WecSoA;
+
+//------------------------------------------------------------------------------
+
+WecSoA WecSoACreate(size_t capacity);
+void WecSoADestroy(WecSoA * soa);
+
+size_t WecSoACount(const WecSoA * soa);
+size_t WecSoAAppend(WecSoA * soa, Wectangle wec);
+size_t WecSoAAppendArray(WecSoA * soa, r_array * wecs);
+Wectangle WecSoAGet(const WecSoA * soa, size_t idx);
+void WecSoASet(WecSoA * soa, size_t idx, Wectangle wec);
+void WecSoARebake(WecSoA * soa);
+
+void WecSoABounds(const WecSoA * soa, Rectangle * out);
+void WecSoACorners(const WecSoA * soa, WecCorners * out);
+size_t WecSoAQueryPoint(const WecSoA * soa, Vector2 point, r_array * out_indices);
+size_t WecSoAQueryWec(const WecSoA * soa, Wectangle wec, r_array * out_indices);
+size_t WecSoAFilterPairs(const WecSoA * soa, r_array * pairs);
+
+//------------------------------------------------------------------------------
+// INTERNALS
+
+// the columns as plain pointers
+typedef struct {
+    const float * x;
+    const float * y;
+    const float * width;
+    const float * height;
+    const float * sin_rot;
+    const float * cos_rot;
+} WecSoAColumns;
+
+WecSoAColumns WecSoAGetColumns(const WecSoA * soa) {
+    return (WecSoAColumns) {
+        (const float *) soa->x.ra.memory.root,
+        (const float *) soa->y.ra.memory.root,
+        (const float *) soa->width.ra.memory.root,
+        (const float *) soa->height.ra.memory.root,
+        (const float *) soa->sin_rot.ra.memory.root,
+        (const float *) soa->cos_rot.ra.memory.root
+    };
+}
+
+// whether two rotated rectangles overlap, by their separating axes, from the vector between their centers, their (positive) half-extents, and their sines and cosines.
+// a's edge directions are (ac, as) and (-as, ac), likewise b's; every dot product between them is +-A or +-B below, so each axis costs a handful of multiplies.
+// agrees with CheckCollisionWecsBaked() except, possibly, for pairs within rounding of touching
+bool WecSoAOverlap(float bx, float by, float ahx, float ahy, float as, float ac, float bhx, float bhy, float bs, float bc) {
+    float A = fabsf(ac * bc + as * bs);
+    float B = fabsf(as * bc - ac * bs);
+
+    return (fabsf(bx * ac + by * as) < ahx + bhx * A + bhy * B)
+        && (fabsf(by * ac - bx * as) < ahy + bhx * B + bhy * A)
+        && (fabsf(bx * bc + by * bs) < bhx + ahx * A + ahy * B)
+        && (fabsf(by * bc - bx * bs) < bhy + ahx * B + ahy * A);
+}
+
+#ifdef RA_SIMD_LANES
+// WecSoAOverlap() for a register's worth of pairs; a bit per lane
+static inline unsigned WecSoAVfOverlap(ra_internal_vf bx, ra_internal_vf by, ra_internal_vf ahx, ra_internal_vf ahy, ra_internal_vf as, ra_internal_vf ac, ra_internal_vf bhx, ra_internal_vf bhy, ra_internal_vf bs, ra_internal_vf bc) {
+    ra_internal_vf A = RA_VF_ABS(RA_VF_ADD(RA_VF_MUL(ac, bc), RA_VF_MUL(as, bs)));
+    ra_internal_vf B = RA_VF_ABS(RA_VF_SUB(RA_VF_MUL(as, bc), RA_VF_MUL(ac, bs)));
+
+    unsigned mask = RA_VF_LT_MASK(RA_VF_ABS(RA_VF_ADD(RA_VF_MUL(bx, ac), RA_VF_MUL(by, as))), RA_VF_ADD(ahx, RA_VF_ADD(RA_VF_MUL(bhx, A), RA_VF_MUL(bhy, B))));
+    mask &= RA_VF_LT_MASK(RA_VF_ABS(RA_VF_SUB(RA_VF_MUL(by, ac), RA_VF_MUL(bx, as))), RA_VF_ADD(ahy, RA_VF_ADD(RA_VF_MUL(bhx, B), RA_VF_MUL(bhy, A))));
+    mask &= RA_VF_LT_MASK(RA_VF_ABS(RA_VF_ADD(RA_VF_MUL(bx, bc), RA_VF_MUL(by, bs))), RA_VF_ADD(bhx, RA_VF_ADD(RA_VF_MUL(ahx, A), RA_VF_MUL(ahy, B))));
+    mask &= RA_VF_LT_MASK(RA_VF_ABS(RA_VF_SUB(RA_VF_MUL(by, bc), RA_VF_MUL(bx, bs))), RA_VF_ADD(bhy, RA_VF_ADD(RA_VF_MUL(ahx, B), RA_VF_MUL(ahy, A))));
+    return mask;
+}
+
+// centers and (positive) half-extents from positions and sizes
+static inline void WecSoAVfShape(ra_internal_vf x, ra_internal_vf y, ra_internal_vf width, ra_internal_vf height, ra_internal_vf * cx, ra_internal_vf * cy, ra_internal_vf * hx, ra_internal_vf * hy) {
+    ra_internal_vf half = RA_VF_SET1(0.5f);
+    ra_internal_vf signed_hx = RA_VF_MUL(width, half);
+    ra_internal_vf signed_hy = RA_VF_MUL(height, half);
+
+    *cx = RA_VF_ADD(x, signed_hx);
+    *cy = RA_VF_ADD(y, signed_hy);
+    *hx = RA_VF_ABS(signed_hx);
+    *hy = RA_VF_ABS(signed_hy);
+}
+#endif
+
+//------------------------------------------------------------------------------
+// CREATION AND ACCESS
+
+/**
+ * Make an empty WecSoA. The columns are growable. Must be destroyed with `WecSoADestroy()`.
+ *
+ * @param capacity How many Wectangles to make room for up front.
+ * @return The WecSoA.
+ */
+WecSoA WecSoACreate(size_t capacity) {
+    return (WecSoA) {
+        ra_create_growable_float(capacity, RA_DEFAULT_GROWTH_FACTOR),
+        ra_create_growable_float(capacity, RA_DEFAULT_GROWTH_FACTOR),
+        ra_create_growable_float(capacity, RA_DEFAULT_GROWTH_FACTOR),
+        ra_create_growable_float(capacity, RA_DEFAULT_GROWTH_FACTOR),
+        ra_create_growable_float(capacity, RA_DEFAULT_GROWTH_FACTOR),
+        ra_create_growable_float(capacity, RA_DEFAULT_GROWTH_FACTOR),
+        ra_create_growable_float(capacity, RA_DEFAULT_GROWTH_FACTOR)
+    };
+}
+
+/**
+ * Free a WecSoA's memory.
+ */
+void WecSoADestroy(WecSoA * soa) {
+    ra_destroy_float(&soa->x);
+    ra_destroy_float(&soa->y);
+    ra_destroy_float(&soa->width);
+    ra_destroy_float(&soa->height);
+    ra_destroy_float(&soa->rot);
+    ra_destroy_float(&soa->sin_rot);
+    ra_destroy_float(&soa->cos_rot);
+}
+
+/**
+ * Get the number of Wectangles in a WecSoA.
+ */
+size_t WecSoACount(const WecSoA * soa) {
+    return soa->x.ra.count;
+}
+
+/**
+ * Add a Wectangle to a WecSoA.
+ *
+ * @param soa The WecSoA in question.
+ * @param wec The Wectangle to add.
+ * @return Its index.
+ */
+size_t WecSoAAppend(WecSoA * soa, Wectangle wec) {
+    float sin_rot, cos_rot;
+    WectangleSinCos(wec, &sin_rot, &cos_rot);
+
+    ra_append_float(&soa->x, wec.x);
+    ra_append_float(&soa->y, wec.y);
+    ra_append_float(&soa->width, wec.width);
+    ra_append_float(&soa->height, wec.height);
+    ra_append_float(&soa->rot, wec.rot);
+    ra_append_float(&soa->sin_rot, sin_rot);
+    ra_append_float(&soa->cos_rot, cos_rot);
+    return WecSoACount(soa) - 1;
+}
+
+/**
+ * Add every Wectangle in an array to a WecSoA, in order.
+ *
+ * @param soa The WecSoA in question.
+ * @param wecs An `RA_WECTANGLE` array.
+ * @return The number of Wectangles added.
+ */
+size_t WecSoAAppendArray(WecSoA * soa, r_array * wecs) {
+    if(strcmp(wecs->type.typename, "Wectangle") != 0) {
+        #ifndef RA_SILENT
+        printf("WecSoAAppendArray: wecs <%p> holds %s, not Wectangle!\n", wecs, wecs->type.typename);
+        #endif
+        return 0;
+    }
+
+    for(size_t i = 0; i < wecs->count; i++) WecSoAAppend(soa, *(Wectangle *) ra_get_unsafe(wecs, i));
+    return wecs->count;
+}
+
+/**
+ * Get a Wectangle out of a WecSoA. No bounds checking.
+ */
+Wectangle WecSoAGet(const WecSoA * soa, size_t idx) {
+    WecSoAColumns col = WecSoAGetColumns(soa);
+    return (Wectangle) { col.x[idx], col.y[idx], col.width[idx], col.height[idx], ((const float *) soa->rot.ra.memory.root)[idx] };
+}
+
+/**
+ * Overwrite a Wectangle in a WecSoA. The sine and cosine are only recomputed if the rotation changed. No bounds checking.
+ */
+void WecSoASet(WecSoA * soa, size_t idx, Wectangle wec) {
+    float * rot = (float *) soa->rot.ra.memory.root;
+    if(rot[idx] != wec.rot) {
+        rot[idx] = wec.rot;
+        WectangleSinCos(wec, (float *) soa->sin_rot.ra.memory.root + idx, (float *) soa->cos_rot.ra.memory.root + idx);
+    }
+
+    ((float *) soa->x.ra.memory.root)[idx] = wec.x;
+    ((float *) soa->y.ra.memory.root)[idx] = wec.y;
+    ((float *) soa->width.ra.memory.root)[idx] = wec.width;
+    ((float *) soa->height.ra.memory.root)[idx] = wec.height;
+}
+
+/**
+ * Recompute every sine and cosine, after writing to the `rot` column directly.
+ */
+void WecSoARebake(WecSoA * soa) {
+    const float * rot = (const float *) soa->rot.ra.memory.root;
+    float * sin_rot = (float *) soa->sin_rot.ra.memory.root;
+    float * cos_rot = (float *) soa->cos_rot.ra.memory.root;
+
+    for(size_t i = 0; i < WecSoACount(soa); i++) {
+        WectangleSinCos((Wectangle) { .rot = rot[i] }, sin_rot + i, cos_rot + i);
+    }
+}
+
+//------------------------------------------------------------------------------
+// KERNELS
+
+/**
+ * Get the bounding box of every Wectangle in a WecSoA. See `WectangleBounds()`.
+ *
+ * @param soa The WecSoA in question.
+ * @param out Where to put the bounding boxes; room for `WecSoACount(soa)`.
+ */
+void WecSoABounds(const WecSoA * soa, Rectangle * out) {
+    WecSoAColumns col = WecSoAGetColumns(soa);
+    size_t count = WecSoACount(soa);
+    size_t i = 0;
+
+    #ifdef RA_SIMD_LANES
+    for(; i + RA_SIMD_LANES <= count; i += RA_SIMD_LANES) {
+        ra_internal_vf cx, cy, hx, hy;
+        WecSoAVfShape(RA_VF_LOAD(col.x + i), RA_VF_LOAD(col.y + i), RA_VF_LOAD(col.width + i), RA_VF_LOAD(col.height + i), &cx, &cy, &hx, &hy);
+        ra_internal_vf s = RA_VF_ABS(RA_VF_LOAD(col.sin_rot + i));
+        ra_internal_vf c = RA_VF_ABS(RA_VF_LOAD(col.cos_rot + i));
+        ra_internal_vf extent_x = RA_VF_ADD(RA_VF_MUL(c, hx), RA_VF_MUL(s, hy));
+        ra_internal_vf extent_y = RA_VF_ADD(RA_VF_MUL(s, hx), RA_VF_MUL(c, hy));
+
+        float bx[RA_SIMD_LANES], by[RA_SIMD_LANES], bw[RA_SIMD_LANES], bh[RA_SIMD_LANES];
+        RA_VF_STORE(bx, RA_VF_SUB(cx, extent_x));
+        RA_VF_STORE(by, RA_VF_SUB(cy, extent_y));
+        RA_VF_STORE(bw, RA_VF_ADD(extent_x, extent_x));
+        RA_VF_STORE(bh, RA_VF_ADD(extent_y, extent_y));
+        for(int l = 0; l < RA_SIMD_LANES; l++) out[i + l] = (Rectangle) { bx[l], by[l], bw[l], bh[l] };
+    }
+    #endif
+
+    for(; i < count; i++) {
+        Vector2 center = { col.x[i] + 0.5f * col.width[i], col.y[i] + 0.5f * col.height[i] };
+        Vector2 half = { fabsf(col.width[i] * 0.5f), fabsf(col.height[i] * 0.5f) };
+        out[i] = WecBoundsOf(center, half, col.sin_rot[i], col.cos_rot[i]);
+    }
+}
+
+/**
+ * Get the corners of every Wectangle in a WecSoA, ordered as in `WecBaked`.
+ *
+ * @param soa The WecSoA in question.
+ * @param out Where to put the corners; room for `WecSoACount(soa)`.
+ */
+void WecSoACorners(const WecSoA * soa, WecCorners * out) {
+    WecSoAColumns col = WecSoAGetColumns(soa);
+    size_t count = WecSoACount(soa);
+    size_t i = 0;
+
+    #ifdef RA_SIMD_LANES
+    ra_internal_vf half = RA_VF_SET1(0.5f);
+    for(; i + RA_SIMD_LANES <= count; i += RA_SIMD_LANES) {
+        ra_internal_vf hx = RA_VF_MUL(RA_VF_LOAD(col.width + i), half);
+        ra_internal_vf hy = RA_VF_MUL(RA_VF_LOAD(col.height + i), half);
+        ra_internal_vf cx = RA_VF_ADD(RA_VF_LOAD(col.x + i), hx);
+        ra_internal_vf cy = RA_VF_ADD(RA_VF_LOAD(col.y + i), hy);
+        ra_internal_vf s = RA_VF_LOAD(col.sin_rot + i);
+        ra_internal_vf c = RA_VF_LOAD(col.cos_rot + i);
+        ra_internal_vf hxc = RA_VF_MUL(hx, c), hxs = RA_VF_MUL(hx, s), hyc = RA_VF_MUL(hy, c), hys = RA_VF_MUL(hy, s);
+
+        // same arithmetic as WecCornersOf()
+        float p[8][RA_SIMD_LANES];
+        RA_VF_STORE(p[0], RA_VF_ADD(RA_VF_SUB(cx, hxc), hys));
+        RA_VF_STORE(p[1], RA_VF_SUB(RA_VF_SUB(cy, hxs), hyc));
+        RA_VF_STORE(p[2], RA_VF_ADD(RA_VF_ADD(cx, hxc), hys));
+        RA_VF_STORE(p[3], RA_VF_SUB(RA_VF_ADD(cy, hxs), hyc));
+        RA_VF_STORE(p[4], RA_VF_SUB(RA_VF_ADD(cx, hxc), hys));
+        RA_VF_STORE(p[5], RA_VF_ADD(RA_VF_ADD(cy, hxs), hyc));
+        RA_VF_STORE(p[6], RA_VF_SUB(RA_VF_SUB(cx, hxc), hys));
+        RA_VF_STORE(p[7], RA_VF_ADD(RA_VF_SUB(cy, hxs), hyc));
+        for(int l = 0; l < RA_SIMD_LANES; l++) {
+            out[i + l] = (WecCorners) { { p[0][l], p[1][l] }, { p[2][l], p[3][l] }, { p[4][l], p[5][l] }, { p[6][l], p[7][l] } };
+        }
+    }
+    #endif
+
+    for(; i < count; i++) {
+        Vector2 center = { col.x[i] + 0.5f * col.width[i], col.y[i] + 0.5f * col.height[i] };
+        out[i] = WecCornersOf(center, col.width[i], col.height[i], col.sin_rot[i], col.cos_rot[i]);
+    }
+}
+
+/**
+ * Find the Wectangles in a WecSoA that contain a point. See `CheckCollisionPointWecBaked()`.
+ *
+ * @param soa The WecSoA in question.
+ * @param point The point in question.
+ * @param out_indices An `RA_INT` array; the indices are appended in increasing order.
+ * @return The number of indices appended.
+ */
+size_t WecSoAQueryPoint(const WecSoA * soa, Vector2 point, r_array * out_indices) {
+    WecSoAColumns col = WecSoAGetColumns(soa);
+    size_t count = WecSoACount(soa);
+    size_t found = 0;
+    size_t i = 0;
+
+    #ifdef RA_SIMD_LANES
+    ra_internal_vf px = RA_VF_SET1(point.x);
+    ra_internal_vf py = RA_VF_SET1(point.y);
+    for(; i + RA_SIMD_LANES <= count; i += RA_SIMD_LANES) {
+        ra_internal_vf cx, cy, hx, hy;
+        WecSoAVfShape(RA_VF_LOAD(col.x + i), RA_VF_LOAD(col.y + i), RA_VF_LOAD(col.width + i), RA_VF_LOAD(col.height + i), &cx, &cy, &hx, &hy);
+        ra_internal_vf s = RA_VF_LOAD(col.sin_rot + i);
+        ra_internal_vf c = RA_VF_LOAD(col.cos_rot + i);
+        ra_internal_vf dx = RA_VF_SUB(px, cx);
+        ra_internal_vf dy = RA_VF_SUB(py, cy);
+
+        unsigned mask = RA_VF_LT_MASK(RA_VF_ABS(RA_VF_ADD(RA_VF_MUL(dx, c), RA_VF_MUL(dy, s))), hx);
+        mask &= RA_VF_LT_MASK(RA_VF_ABS(RA_VF_SUB(RA_VF_MUL(dy, c), RA_VF_MUL(dx, s))), hy);
+        for(; mask != 0; mask &= mask - 1) {
+            int idx = (int) i + ra_internal_lowest_bit(mask);
+            ra_append_n(out_indices, &idx, 1);
+            found++;
+        }
+    }
+    #endif
+
+    for(; i < count; i++) {
+        float dx = point.x - (col.x[i] + 0.5f * col.width[i]);
+        float dy = point.y - (col.y[i] + 0.5f * col.height[i]);
+        if(fabsf(dx * col.cos_rot[i] + dy * col.sin_rot[i]) < fabsf(col.width[i] * 0.5f) && fabsf(dy * col.cos_rot[i] - dx * col.sin_rot[i]) < fabsf(col.height[i] * 0.5f)) {
+            int idx = (int) i;
+            ra_append_n(out_indices, &idx, 1);
+            found++;
+        }
+    }
+
+    return found;
+}
+
+/**
+ * Find the Wectangles in a WecSoA that collide with a Wectangle. See `CheckCollisionWecs()`.
+ *
+ * @param soa The WecSoA in question.
+ * @param wec The Wectangle in question.
+ * @param out_indices An `RA_INT` array; the indices are appended in increasing order.
+ * @return The number of indices appended.
+ */
+size_t WecSoAQueryWec(const WecSoA * soa, Wectangle wec, r_array * out_indices) {
+    WecSoAColumns col = WecSoAGetColumns(soa);
+    size_t count = WecSoACount(soa);
+    WecBaked baked = BakeWectangle(wec);
+    size_t found = 0;
+    size_t i = 0;
+
+    #ifdef RA_SIMD_LANES
+    ra_internal_vf wx = RA_VF_SET1(baked.center.x), wy = RA_VF_SET1(baked.center.y);
+    ra_internal_vf whx = RA_VF_SET1(baked.half.x), why = RA_VF_SET1(baked.half.y);
+    ra_internal_vf ws = RA_VF_SET1(baked.sin_rot), wc = RA_VF_SET1(baked.cos_rot);
+    for(; i + RA_SIMD_LANES <= count; i += RA_SIMD_LANES) {
+        ra_internal_vf cx, cy, hx, hy;
+        WecSoAVfShape(RA_VF_LOAD(col.x + i), RA_VF_LOAD(col.y + i), RA_VF_LOAD(col.width + i), RA_VF_LOAD(col.height + i), &cx, &cy, &hx, &hy);
+
+        unsigned mask = WecSoAVfOverlap(RA_VF_SUB(wx, cx), RA_VF_SUB(wy, cy), hx, hy, RA_VF_LOAD(col.sin_rot + i), RA_VF_LOAD(col.cos_rot + i), whx, why, ws, wc);
+        for(; mask != 0; mask &= mask - 1) {
+            int idx = (int) i + ra_internal_lowest_bit(mask);
+            ra_append_n(out_indices, &idx, 1);
+            found++;
+        }
+    }
+    #endif
+
+    for(; i < count; i++) {
+        float bx = baked.center.x - (col.x[i] + 0.5f * col.width[i]);
+        float by = baked.center.y - (col.y[i] + 0.5f * col.height[i]);
+        if(WecSoAOverlap(bx, by, fabsf(col.width[i] * 0.5f), fabsf(col.height[i] * 0.5f), col.sin_rot[i], col.cos_rot[i], baked.half.x, baked.half.y, baked.sin_rot, baked.cos_rot)) {
+            int idx = (int) i;
+            ra_append_n(out_indices, &idx, 1);
+            found++;
+        }
+    }
+
+    return found;
+}
+
+/**
+ * Keep only the pairs whose Wectangles collide, e.g. to narrow `WecGridPairs()`'s candidates down. The Wectangles are gathered a register's worth of pairs at a time and tested together. See `CheckCollisionWecs()`.
+ *
+ * @param soa The WecSoA the pairs index into.
+ * @param pairs An `RA_WECPAIR` array; filtered in place, keeping the order.
+ * @return The number of pairs kept.
+ */
+size_t WecSoAFilterPairs(const WecSoA * soa, r_array * pairs) {
+    if(strcmp(pairs->type.typename, "WecPair") != 0) {
+        #ifndef RA_SILENT
+        printf("WecSoAFilterPairs: pairs <%p> holds %s, not WecPair!\n", pairs, pairs->type.typename);
+        #endif
+        return 0;
+    }
+
+    WecSoAColumns col = WecSoAGetColumns(soa);
+    WecPair * data = (WecPair *) pairs->memory.root;
+    size_t count = pairs->count;
+    size_t kept = 0;
+    size_t i = 0;
+
+    #ifdef RA_SIMD_LANES
+    for(; i + RA_SIMD_LANES <= count; i += RA_SIMD_LANES) {
+        float g[12][RA_SIMD_LANES]; // gathered x, y, width, height, sin, cos; a's then b's
+        for(int l = 0; l < RA_SIMD_LANES; l++) {
+            int a = data[i + l].a;
+            int b = data[i + l].b;
+            g[0][l] = col.x[a]; g[1][l] = col.y[a]; g[2][l] = col.width[a]; g[3][l] = col.height[a]; g[4][l] = col.sin_rot[a]; g[5][l] = col.cos_rot[a];
+            g[6][l] = col.x[b]; g[7][l] = col.y[b]; g[8][l] = col.width[b]; g[9][l] = col.height[b]; g[10][l] = col.sin_rot[b]; g[11][l] = col.cos_rot[b];
+        }
+
+        ra_internal_vf acx, acy, ahx, ahy, bcx, bcy, bhx, bhy;
+        WecSoAVfShape(RA_VF_LOAD(g[0]), RA_VF_LOAD(g[1]), RA_VF_LOAD(g[2]), RA_VF_LOAD(g[3]), &acx, &acy, &ahx, &ahy);
+        WecSoAVfShape(RA_VF_LOAD(g[6]), RA_VF_LOAD(g[7]), RA_VF_LOAD(g[8]), RA_VF_LOAD(g[9]), &bcx, &bcy, &bhx, &bhy);
+
+        unsigned mask = WecSoAVfOverlap(RA_VF_SUB(bcx, acx), RA_VF_SUB(bcy, acy), ahx, ahy, RA_VF_LOAD(g[4]), RA_VF_LOAD(g[5]), bhx, bhy, RA_VF_LOAD(g[10]), RA_VF_LOAD(g[11]));
+        for(; mask != 0; mask &= mask - 1) data[kept++] = data[i + ra_internal_lowest_bit(mask)];
+    }
+    #endif
+
+    for(; i < count; i++) {
+        int a = data[i].a;
+        int b = data[i].b;
+        float bx = (col.x[b] + 0.5f * col.width[b]) - (col.x[a] + 0.5f * col.width[a]);
+        float by = (col.y[b] + 0.5f * col.height[b]) - (col.y[a] + 0.5f * col.height[a]);
+        if(WecSoAOverlap(bx, by, fabsf(col.width[a] * 0.5f), fabsf(col.height[a] * 0.5f), col.sin_rot[a], col.cos_rot[a], fabsf(col.width[b] * 0.5f), fabsf(col.height[b] * 0.5f), col.sin_rot[b], col.cos_rot[b])) {
+            data[kept++] = data[i];
+        }
+    }
+
+    ra_truncate(pairs, kept);
+    return kept;
+}
@@ -29,6 +29,16 @@ typedef struct {
     float rot;
 } Wectangle;
 
+/**
+ * A pair of Wectangles, by their indices in some array (e.g. the candidate pairs a `WecGrid` finds). `a < b`.
+ * 
+ * @param a, b The indices.
+ */
+typedef struct {
+    int a;
+    int b;
+} WecPair;
+
 //------------------------------------------------------------------------------
 
 void DrawWectangle(float posX, float posY, float width, float height, float rot, Color color);
@@ -45,6 +55,11 @@ Vector2 WectanglePos(Wectangle wec);
 Vector2 WectangleAxis(Wectangle wec);
 Vector2 WectangleDim(Wectangle wec);
 float WectangleChord(Wectangle wec);
+void WectangleSinCos(Wectangle wec, float * sin_rot, float * cos_rot);
+Rectangle WectangleBounds(Wectangle wec);
+int WectangleEquals(Wectangle a, Wectangle b);
+int WecPairEquals(WecPair a, WecPair b);
+int WecPairLess(WecPair a, WecPair b);
 
 /**
  * The triangles of a Wectangle.
@@ -70,14 +85,51 @@ typedef struct {
 
 WecCorners WectangleCorners(Wectangle wec);
 
+/**
+ * A Wectangle with its rotation worked out ahead of time. Every `Wectangle` function has to work out the sine, cosine and corners of its Wectangles on every call; the `...Baked()` functions read them from here instead. Worth it for Wectangles that are queried (or drawn) more often than they change, e.g. level geometry. Make with `BakeWectangle()`, and keep up to date with `RebakeWectangle()` or `TranslateWecBaked()`; don't change the fields by hand.
+ * 
+ * @param wec The Wectangle this was baked from.
+ * @param sin_rot, cos_rot The sine and cosine of `wec.rot` (see `WectangleSinCos()`).
+ * @param center The center of the Wectangle (see `WectangleAxis()`).
+ * @param half Half of the width and height, always positive.
+ * @param corners The corners, in order around the Wectangle; `a` is the top-left corner before rotation, then clockwise (on screen).
+ * @param bounds The bounding box (see `WectangleBounds()`).
+ */
+typedef struct {
+    Wectangle wec;
+    float sin_rot, cos_rot;
+    Vector2 center;
+    Vector2 half;
+    WecCorners corners;
+    Rectangle bounds;
+} WecBaked;
+
+WecBaked BakeWectangle(Wectangle wec);
+void RebakeWectangle(WecBaked * baked, Wectangle wec);
+WecBaked TranslateWecBaked(WecBaked baked, Vector2 trans);
+WectTris WectangleTrisBaked(WecBaked baked);
+
+void DrawWectangleBaked(WecBaked baked, Color color);
+void DrawWectangleLinesBaked(WecBaked baked, Color color);
+void DrawWectangleTexBaked(WecBaked baked, Texture2D tex, Color tint);
+
 bool CheckCollisionPointWec(Vector2 a, Wectangle b);
+bool CheckCollisionCircleWec(Vector2 c, float radius, Wectangle wec);
+bool GetCollisionCircleWec(Vector2 c, float radius, Wectangle wec, Vector2 * output);
+size_t CheckCollisionPointsWec(const Vector2 * points, size_t count, Wectangle wec, bool * out);
+size_t CheckCollisionCirclesWec(const Vector2 * centers, size_t count, float radius, Wectangle wec, bool * out);
 bool CheckCollisionWecs(Wectangle a, Wectangle b);
 bool CheckCollisionWecRec(Wectangle a, Rectangle b);
 
+bool CheckCollisionPointWecBaked(Vector2 point, WecBaked baked);
+bool CheckCollisionCircleWecBaked(Vector2 c, float radius, WecBaked baked);
+bool CheckCollisionWecsBaked(WecBaked a, WecBaked b);
+bool CheckCollisionWecRecBaked(WecBaked a, Rectangle b);
+
 /**
- * A dynamic list of collision points between two Wectangles (or a Wectangle and a Rectangle). `GetCollisionWec()` performs `malloc()` on `tris`, be sure to `free()`!
+ * Where two Wectangles (or a Wectangle and a Rectangle) overlap: the corners of the overlapping region. Doesn't own `points`; they live in the buffer passed to a `GetCollision*Into()` function, or, for the others, in a static buffer that the next call overwrites.
  * 
- * @param points A **potentially NULL** list of `Vector2` that represents in (hopefully; this is still W.I.P) counter-clockwise order the up to eight points where two rectangles can collide. If `num_points` is zero, this will be `NULL`.
+ * @param points A **potentially NULL** list of `Vector2`, the up to eight corners of the overlap in counter-clockwise (renderable) order. If `num_points` is zero, this will be `NULL`.
  * @param num_points The number of points in `points`. If this is zero, points is `NULL`.
  */
 typedef struct {
@@ -87,9 +139,73 @@ typedef struct {
 
 WecCollision GetCollisionWecs(Wectangle a, Wectangle b);
 WecCollision GetCollisionWecRec(Wectangle a, Rectangle b);
+WecCollision GetCollisionWecsBaked(WecBaked a, WecBaked b);
+
+WecCollision GetCollisionWecsInto(Wectangle a, Wectangle b, Vector2 out[8]);
+WecCollision GetCollisionWecRecInto(Wectangle a, Rectangle b, Vector2 out[8]);
+WecCollision GetCollisionWecsBakedInto(WecBaked a, WecBaked b, Vector2 out[8]);
 
 float WecCollisionArea(WecCollision coll);
 
+/**
+ * Everything a physics solver needs to know about two overlapping Wectangles, from one query (see `GetManifoldWecs()`). All zeroes if they don't overlap.
+ * 
+ * @param normal The direction (a unit vector, from `a` towards `b`) to push them apart along; the edge normal they overlap least on.
+ * @param depth How far they overlap along `normal`. Moving `b` by `normal * depth` (or `a` by `-normal * depth`, or each half that) separates them.
+ * @param points The corners of the overlapping region, in counter-clockwise (renderable) order, i.e. the contact points. See `WecCollision`.
+ * @param num_points The number of points in `points`.
+ * @param area The area of the overlapping region.
+ * @param centroid The center of the overlapping region, for when one contact point is enough.
+ */
+typedef struct {
+    Vector2 normal;
+    float depth;
+    Vector2 points[8];
+    unsigned int num_points;
+    float area;
+    Vector2 centroid;
+} WecManifold;
+
+WecManifold GetManifoldWecs(Wectangle a, Wectangle b);
+WecManifold GetManifoldWecRec(Wectangle a, Rectangle b);
+WecManifold GetManifoldWecsBaked(WecBaked a, WecBaked b);
+
+/**
+ * The result of sweeping a moving Wectangle against another (see `SweepWectangle()`): when during the move they first touch, and along what. All zeroes if they don't.
+ * 
+ * @param hit Whether they touch at some point during the move.
+ * @param time When they first touch, as a fraction of the move: `0.0f` at the start (or if they already overlap), `1.0f` at the end. Moving `a` by `velocity * time` brings it up against `b` without passing through.
+ * @param normal The edge normal they touch along, a unit vector from `a` towards `b` (like `WecManifold`). Removing it from the velocity, `velocity - normal * dot(velocity, normal)`, slides `a` along `b`.
+ */
+typedef struct {
+    bool hit;
+    float time;
+    Vector2 normal;
+} WecSweep;
+
+WecSweep SweepWectangle(Wectangle a, Vector2 velocity, Wectangle b);
+WecSweep SweepWectangleRec(Wectangle a, Vector2 velocity, Rectangle b);
+WecSweep SweepWectangleEx(Wectangle a, Vector2 velocity, float spin, Wectangle b);
+WecSweep SweepWecsBaked(WecBaked a, Vector2 velocity, WecBaked b);
+
+/**
+ * Where a ray first hits a Wectangle (see `RaycastWectangle()`). All zeroes if it doesn't.
+ * 
+ * @param hit Whether the ray hits.
+ * @param distance How far along the ray the hit is.
+ * @param point Where the hit is.
+ * @param normal The normal of the edge that was hit, a unit vector facing back towards the ray's origin.
+ */
+typedef struct {
+    bool hit;
+    float distance;
+    Vector2 point;
+    Vector2 normal;
+} WecRayHit;
+
+WecRayHit RaycastWectangle(Vector2 origin, Vector2 direction, float max_distance, Wectangle wec);
+WecRayHit RaycastWecBaked(Vector2 origin, Vector2 direction, float max_distance, WecBaked baked);
+
 Wectangle TranslateWectangle(Wectangle wec, Vector2 trans);
 
 //------------------------------------------------------------------------------
@@ -172,79 +288,13 @@ void DrawWectangleLinesEx(Wectangle wec, float lineThick, Color color) {
 // TEXTURE DRAWING
 
 /**
- * Draw a texture within a Wectangle. This will scale the texture of the bounds of the Wectangle, and rotate it accordingly.
+ * Draw a texture within a Wectangle. This will scale the texture of the bounds of the Wectangle, and rotate it accordingly. `DrawTexturePro()` rotates about its `origin`, so the origin goes at the Wectangle's center; no corners needed. For lots of these, see `WectangleBatch` (wecbatch.h).
  */
 void DrawWectangleTex(Wectangle wec, Texture2D tex, Color tint) {
-    int posX = wec.x;
-    int posY = wec.y;
-    int width = wec.width;
-    int height = wec.height;
-    float rot = fmodf(wec.rot, 360.0f);
-
-    WecCorners corners = WectangleCorners(wec);
-
-    Vector2 a0 = corners.a;
-    Vector2 a1 = corners.b;
-    Vector2 a2 = corners.c;
-    Vector2 a3 = corners.d;
-
-    Vector2 points[4] = { a0, a1, a2, a3 };
-
-    // temporary init - these change
-    Vector2 lc = a0;
-    Vector2 rc = a1;
-    Vector2 tc = a2;
-    Vector2 bc = a3;
-
-    for(int i = 0; i < 4; i++) {
-        Vector2 p = points[i];
-
-        if(p.x <= lc.x)
-            lc = p;
-        
-        if(p.x >= rc.x)
-            rc = p;
-
-        if(p.y <= tc.y)
-            tc = p;
-        
-        if(p.y >= bc.y)
-            bc = p;
-    }
-
-    // when the rectangle is at a flat angle (90., 180, 270, 360),
-    // the vertices in clockwise order are tc, rc, bc, lc (hopefully?)
-    /*
-            tc-----rc
-             |     |
-            lc-----bc
-    */
-
-    // tex origin
-    Vector2 to = lc;
-
-    if(rot > 270.0f && rot < 360.0f) {
-        to = lc;
-    } else if(rot > 0.0f && rot < 90.0f) {
-        to = tc;
-    } else if(rot > 90.0f && rot < 180.0f) {
-        to = rc;
-    } else if(rot > 180.0f && rot <= 270.0f) {
-        to = bc;
-    }
-
-    if(rot == 0.0f) {
-        to.y -= wec.height;
-    } else if(rot == 90.0f) {
-        to.x += wec.height;
-    } else if(rot == 180.0f) {
-        to.y += wec.height;
-        to.x += wec.width;
-    } else if(rot == 270.0f) {
-        to.x -= wec.height;
-    }
-
-    DrawTexturePro(tex, (Rectangle) { 0, 0, tex.width, tex.height }, (Rectangle) { to.x, to.y, wec.width, wec.height }, Vector2Zero(), wec.rot, tint);
+    Vector2 center = WectangleAxis(wec);
+    Rectangle dest = { center.x, center.y, wec.width, wec.height };
+    Vector2 origin = { wec.width * 0.5f, wec.height * 0.5f };
+    DrawTexturePro(tex, (Rectangle) { 0, 0, tex.width, tex.height }, dest, origin, wec.rot, tint);
 }
 
 //----------------------------
@@ -299,6 +349,36 @@ Vector2 WectangleDim(Wectangle wec) {
     return (Vector2) { wec.width, wec.height };
 }
 
+/**
+ * Check whether two Wectangles are (approximately) equal, using raymath's `FloatEquals()` on every field. This is the comparison the Wectangle `r_array` uses.
+ * 
+ * @param a, b The Wectangles in question.
+ * @return `1` if they are equal, `0` otherwise (like raymath's `Vector2Equals()`).
+ */
+int WectangleEquals(Wectangle a, Wectangle b) {
+    return FloatEquals(a.x, b.x) && FloatEquals(a.y, b.y) && FloatEquals(a.width, b.width) && FloatEquals(a.height, b.height) && FloatEquals(a.rot, b.rot);
+}
+
+/**
+ * Check whether two WecPairs are the same pair. This is the comparison the WecPair `r_array` uses.
+ * 
+ * @param a, b The WecPairs in question.
+ * @return `1` if they are equal, `0` otherwise.
+ */
+int WecPairEquals(WecPair a, WecPair b) {
+    return (a.a == b.a) && (a.b == b.b);
+}
+
+/**
+ * Order WecPairs by `a`, then `b`. This is the ordering `ra_sort()` uses for the WecPair `r_array`.
+ * 
+ * @param a, b The WecPairs in question.
+ * @return `1` if `a` goes before `b`, `0` otherwise.
+ */
+int WecPairLess(WecPair a, WecPair b) {
+    return (a.a < b.a) || (a.a == b.a && a.b < b.b);
+}
+
 /**
  * Get the longest distance between two of the Wectangle's corners.
 ```
@@ -317,32 +397,75 @@ float WectangleChord(Wectangle wec) {
 }
 
 /**
- * Get the two triangles that make up a Wectangle. These two triangles (see `WectTris`) should be ordered counter-clockwise (renderable).
+ * Get the sine and cosine of a Wectangle's rotation. Multiples of 90 degrees give exact `0`s and `1`s (`sinf(PI)` isn't quite `0`), so axis-aligned Wectangles stay exactly axis-aligned.
  * 
  * @param wec The Wectangle in question.
- * @return See `WectTris`.
+ * @param sin_rot Where to put the sine.
+ * @param cos_rot Where to put the cosine.
  */
-WectTris WectangleTris(Wectangle wec) {
-    int posX = wec.x;
-    int posY = wec.y;
-    int width = wec.width;
-    int height = wec.height;
-    float rot = wec.rot;
+void WectangleSinCos(Wectangle wec, float * sin_rot, float * cos_rot) {
+    float rot = fmodf(wec.rot, 360.0f);
+    if(rot < 0.0f) rot += 360.0f;
 
-    WecCorners corners = WectangleCorners(wec);
+    if(rot == 0.0f) {
+        *sin_rot = 0.0f;
+        *cos_rot = 1.0f;
+    } else if(rot == 90.0f) {
+        *sin_rot = 1.0f;
+        *cos_rot = 0.0f;
+    } else if(rot == 180.0f) {
+        *sin_rot = 0.0f;
+        *cos_rot = -1.0f;
+    } else if(rot == 270.0f) {
+        *sin_rot = -1.0f;
+        *cos_rot = 0.0f;
+    } else {
+        *sin_rot = sinf(DEG2RAD * wec.rot);
+        *cos_rot = cosf(DEG2RAD * wec.rot);
+    }
+}
 
-    Vector2 a0 = corners.a;
-    Vector2 a1 = corners.b;
-    Vector2 a2 = corners.c;
-    Vector2 a3 = corners.d;
+// the bounding box of a rectangle with half-extents `half` centered on `center`, rotated
+Rectangle WecBoundsOf(Vector2 center, Vector2 half, float sin_rot, float cos_rot) {
+    float extent_x = fabsf(cos_rot) * half.x + fabsf(sin_rot) * half.y;
+    float extent_y = fabsf(sin_rot) * half.x + fabsf(cos_rot) * half.y;
+    return (Rectangle) { center.x - extent_x, center.y - extent_y, 2.0f * extent_x, 2.0f * extent_y };
+}
 
-    Vector2 points[4] = { a0, a1, a2, a3 };
+/**
+ * Get the smallest axis-aligned Rectangle containing a Wectangle.
+ * 
+ * @param wec The Wectangle in question.
+ * @return The bounding box. For an unrotated Wectangle, this is the Wectangle itself.
+ */
+Rectangle WectangleBounds(Wectangle wec) {
+    float sin_rot, cos_rot;
+    WectangleSinCos(wec, &sin_rot, &cos_rot);
+    return WecBoundsOf(WectangleAxis(wec), (Vector2) { fabsf(wec.width) * 0.5f, fabsf(wec.height) * 0.5f }, sin_rot, cos_rot);
+}
+
+// the corners of a width x height rectangle centered on `center`, rotated; `a` is the top-left one before rotation
+WecCorners WecCornersOf(Vector2 center, float width, float height, float sin_rot, float cos_rot) {
+    float hx = width * 0.5f;
+    float hy = height * 0.5f;
+
+    return (WecCorners) {
+        { center.x - hx * cos_rot + hy * sin_rot, center.y - hx * sin_rot - hy * cos_rot },
+        { center.x + hx * cos_rot + hy * sin_rot, center.y + hx * sin_rot - hy * cos_rot },
+        { center.x + hx * cos_rot - hy * sin_rot, center.y + hx * sin_rot + hy * cos_rot },
+        { center.x - hx * cos_rot - hy * sin_rot, center.y - hx * sin_rot + hy * cos_rot }
+    };
+}
+
+// split corners into two counter-clockwise triangles, by which corner is furthest left, right, up and down
+WectTris WecCornersTris(WecCorners corners) {
+    Vector2 points[4] = { corners.a, corners.b, corners.c, corners.d };
 
     // temporary init - these change
-    Vector2 lc = a0;
-    Vector2 rc = a1;
-    Vector2 tc = a2;
-    Vector2 bc = a3;
+    Vector2 lc = corners.a;
+    Vector2 rc = corners.b;
+    Vector2 tc = corners.c;
+    Vector2 bc = corners.d;
 
     for(int i = 0; i < 4; i++) {
         Vector2 p = points[i];
@@ -363,6 +486,16 @@ WectTris WectangleTris(Wectangle wec) {
     return (WectTris) { rc, tc, lc, bc, rc, lc };
 }
 
+/**
+ * Get the two triangles that make up a Wectangle. These two triangles (see `WectTris`) should be ordered counter-clockwise (renderable).
+ * 
+ * @param wec The Wectangle in question.
+ * @return See `WectTris`.
+ */
+WectTris WectangleTris(Wectangle wec) {
+    return WecCornersTris(WectangleCorners(wec));
+}
+
 /**
  * Get the corners of a Wectangle in no particular order.
  * 
@@ -370,127 +503,143 @@ WectTris WectangleTris(Wectangle wec) {
  * @return See `WecCorners`.
  */
 WecCorners WectangleCorners(Wectangle wec) {
-    int posX = wec.x;
-    int posY = wec.y;
-    int width = wec.width;
-    int height = wec.height;
-    float rot = wec.rot;
+    float sin_rot, cos_rot;
+    WectangleSinCos(wec, &sin_rot, &cos_rot);
+    return WecCornersOf(WectangleAxis(wec), wec.width, wec.height, sin_rot, cos_rot);
+}
 
-    // p = prior to rotation
-    Vector2 p0 = (Vector2) { posX, posY };
-    Vector2 p1 = (Vector2) { posX + width, posY };
-    Vector2 p2 = (Vector2) { posX + width, posY + height };
-    Vector2 p3 = (Vector2) { posX, posY + height };
+// a point in a Wectangle's frame: relative to its center, `x` along its width and `y` along its height
+Vector2 WecLocalPoint(Vector2 point, Vector2 center, float sin_rot, float cos_rot) {
+    Vector2 d = Vector2Subtract(point, center);
+    return (Vector2) { d.x * cos_rot + d.y * sin_rot, d.y * cos_rot - d.x * sin_rot };
+}
 
-    Vector2 center = WectangleAxis(wec);
+// whether a circle reaches into a Wectangle (given by its center, positive half-extents, sine and cosine), and the point of the Wectangle closest to the circle's center
+bool WecCircleClosest(Vector2 c, float radius, Vector2 center, Vector2 half, float sin_rot, float cos_rot, Vector2 * closest) {
+    Vector2 local = WecLocalPoint(c, center, sin_rot, cos_rot);
+    Vector2 clamped = { Clamp(local.x, -half.x, half.x), Clamp(local.y, -half.y, half.y) };
 
-    // a = after rotation
-    Vector2 a0 = Vector2Add(Vector2Rotate(Vector2Subtract(p0, center), DEG2RAD * rot), center);
-    Vector2 a1 = Vector2Add(Vector2Rotate(Vector2Subtract(p1, center), DEG2RAD * rot), center);
-    Vector2 a2 = Vector2Add(Vector2Rotate(Vector2Subtract(p2, center), DEG2RAD * rot), center);
-    Vector2 a3 = Vector2Add(Vector2Rotate(Vector2Subtract(p3, center), DEG2RAD * rot), center);
+    if(closest != NULL) {
+        *closest = (Vector2) {
+            center.x + clamped.x * cos_rot - clamped.y * sin_rot,
+            center.y + clamped.x * sin_rot + clamped.y * cos_rot
+        };
+    }
 
-    return (WecCorners) { a0, a1, a2, a3 };
+    if(fabsf(local.x) < half.x && fabsf(local.y) < half.y) return true;
+    float dx = local.x - clamped.x;
+    float dy = local.y - clamped.y;
+    return (dx * dx + dy * dy) < (radius * radius);
 }
 
 /**
- * Check if there is a collision between a Wectangle and a Point (i.e. if that point is within the Wectangle). This works by checking if the line between the point and the center of the Wectangle  intersects any of the faces of the Wectangle. If it does, the point must be outside the Wectangle.
+ * Check if there is a collision between a Wectangle and a Point (i.e. if that point is within the Wectangle). The point is rotated into the Wectangle's frame, where the test is just two comparisons. Points on the edge are outside. Costs one `sinf()`/`cosf()` (none if it's axis-aligned); see `CheckCollisionPointWecBaked()` for none at all, or `CheckCollisionPointsWec()` for lots of points.
  * 
  * @param wec The Wectangle in question.
  * @param point The Point in question.
  * @return Whether or not `point` is inside `wec`.
  */
 bool CheckCollisionPointWec(Vector2 point, Wectangle wec) {
-    WecCorners corners = WectangleCorners(wec);
-    Vector2 axis = WectangleAxis(wec);
-    
-    if(CheckCollisionLines(corners.a, corners.b, point, axis, NULL)) return false;
-    if(CheckCollisionLines(corners.b, corners.c, point, axis, NULL)) return false;
-    if(CheckCollisionLines(corners.c, corners.d, point, axis, NULL)) return false;
-    if(CheckCollisionLines(corners.d, corners.a, point, axis, NULL)) return false;
-    return true;
+    float sin_rot, cos_rot;
+    WectangleSinCos(wec, &sin_rot, &cos_rot);
+
+    Vector2 local = WecLocalPoint(point, WectangleAxis(wec), sin_rot, cos_rot);
+    return (fabsf(local.x) < fabsf(wec.width) * 0.5f) && (fabsf(local.y) < fabsf(wec.height) * 0.5f);
 }
 
 /**
- * Get where a Circle and a Wectangle collide. This will return the first scanned point that is within the Wectangle.
+ * Get where a Circle and a Wectangle collide: the point of the Wectangle closest to the Circle's center. Exact; the center is rotated into the Wectangle's frame and clamped to it.
  * 
  * @param c The center of the Circle in question.
  * @param radius The radius of the Circle in question.
  * @param wec The Wectangle in question.
- * @param output If not `NULL`, the first point found on the Circle within the Wectangle. If no collision, this is `NULL`.
- * @return Check `output` for return value.
- */
-void GetCollisionCircleWec(Vector2 c, float radius, Wectangle wec, Vector2 * output) {
-    for(unsigned int i = 0; i < 20; i++) {
-        float theta = (i / 20.0f) * 2 * PI;
-        Vector2 check = Vector2Add(Vector2Scale((Vector2) { cosf(theta), sinf(theta) }, radius), c);
-        if(CheckCollisionPointWec(check, wec)) {
-            *output = check;
-            return;
-        } 
-    }
-
-    output = NULL; // use an output value here because simply returning Vector2Zero() would be ambiguous.
+ * @param output If not `NULL`, gets the point of `wec` closest to `c` (`c` itself if it's inside), whether or not they collide.
+ * @return Whether or not they collide. Like the other Wectangle checks, only touching isn't colliding.
+ */
+bool GetCollisionCircleWec(Vector2 c, float radius, Wectangle wec, Vector2 * output) {
+    float sin_rot, cos_rot;
+    WectangleSinCos(wec, &sin_rot, &cos_rot);
+    return WecCircleClosest(c, radius, WectangleAxis(wec), (Vector2) { fabsf(wec.width) * 0.5f, fabsf(wec.height) * 0.5f }, sin_rot, cos_rot, output);
 }
 
 /**
- * Check whether a Circle and a Wectangle collide.
+ * Check whether a Circle and a Wectangle collide. See `GetCollisionCircleWec()`.
  * 
  * @param c The center of the Circle in question.
  * @param radius The radius of the Circle in question.
  * @param wec The Wectangle in question.
- * @return A boolean; whether or not `GetCollisionCircleWec(c, radius, wec, check)` sets `check` to `NULL`.
+ * @return `GetCollisionCircleWec(c, radius, wec, NULL);`
  */
 bool CheckCollisionCircleWec(Vector2 c, float radius, Wectangle wec) {
-    Vector2 * check = NULL;
-    GetCollisionCircleWec(c, radius, wec, check);
-   return (check != NULL);
+    return GetCollisionCircleWec(c, radius, wec, NULL);
 }
 
 /**
- * Check whether two Wectangles are colliding.
+ * Check lots of points against one Wectangle. Its rotation is worked out once, then each point costs a few multiplies. See `CheckCollisionPointWec()`.
  * 
- * @param a, b The Wectangles in question.
- * @return Whether or not they collide.
+ * @param points The points in question.
+ * @param count The number of points.
+ * @param wec The Wectangle in question.
+ * @param out If not `NULL`, gets whether each point is inside `wec`; room for `count`.
+ * @return The number of points inside `wec`.
  */
-bool CheckCollisionWecs(Wectangle a, Wectangle b) {
-    a = (Wectangle) { a.x, a.y, a.width, a.height, (fmodf(a.rot, 90.0f) == 0.0f) ? a.rot + 0.02f : a.rot };
-    b = (Wectangle) { b.x, b.y, b.width, b.height, (fmodf(b.rot, 90.0f) == 0.0f) ? b.rot + 0.02f : b.rot };
+size_t CheckCollisionPointsWec(const Vector2 * points, size_t count, Wectangle wec, bool * out) {
+    float sin_rot, cos_rot;
+    WectangleSinCos(wec, &sin_rot, &cos_rot);
+    Vector2 center = WectangleAxis(wec);
+    float half_x = fabsf(wec.width) * 0.5f;
+    float half_y = fabsf(wec.height) * 0.5f;
+
+    size_t inside = 0;
+    for(size_t i = 0; i < count; i++) {
+        Vector2 local = WecLocalPoint(points[i], center, sin_rot, cos_rot);
+        bool hit = (fabsf(local.x) < half_x) & (fabsf(local.y) < half_y);
+        if(out != NULL) out[i] = hit;
+        inside += hit;
+    }
 
-    WecCorners a_corners = WectangleCorners(a);
-    WecCorners b_corners = WectangleCorners(b);
+    return inside;
+}
 
-    if(CheckCollisionPointWec(a_corners.a, b)) return true;
-    if(CheckCollisionPointWec(a_corners.b, b)) return true;
-    if(CheckCollisionPointWec(a_corners.c, b)) return true;
-    if(CheckCollisionPointWec(a_corners.d, b)) return true;
-    
-    if(CheckCollisionPointWec(b_corners.a, a)) return true;
-    if(CheckCollisionPointWec(b_corners.b, a)) return true;
-    if(CheckCollisionPointWec(b_corners.c, a)) return true;
-    if(CheckCollisionPointWec(b_corners.d, a)) return true;
+/**
+ * Check lots of same-sized circles (e.g. bullets or particles) against one Wectangle. See `CheckCollisionPointsWec()` and `CheckCollisionCircleWec()`.
+ * 
+ * @param centers The centers of the circles in question.
+ * @param count The number of circles.
+ * @param radius The radius of every circle.
+ * @param wec The Wectangle in question.
+ * @param out If not `NULL`, gets whether each circle collides with `wec`; room for `count`.
+ * @return The number of circles that collide with `wec`.
+ */
+size_t CheckCollisionCirclesWec(const Vector2 * centers, size_t count, float radius, Wectangle wec, bool * out) {
+    float sin_rot, cos_rot;
+    WectangleSinCos(wec, &sin_rot, &cos_rot);
+    Vector2 center = WectangleAxis(wec);
+    Vector2 half = { fabsf(wec.width) * 0.5f, fabsf(wec.height) * 0.5f };
 
-    if(CheckCollisionLines(a_corners.a, a_corners.b, b_corners.a, b_corners.b, NULL)) return true;
-    if(CheckCollisionLines(a_corners.b, a_corners.c, b_corners.a, b_corners.b, NULL)) return true;
-    if(CheckCollisionLines(a_corners.c, a_corners.d, b_corners.a, b_corners.b, NULL)) return true;
-    if(CheckCollisionLines(a_corners.d, a_corners.a, b_corners.a, b_corners.b, NULL)) return true;
+    size_t hits = 0;
+    for(size_t i = 0; i < count; i++) {
+        bool hit = WecCircleClosest(centers[i], radius, center, half, sin_rot, cos_rot, NULL);
+        if(out != NULL) out[i] = hit;
+        hits += hit;
+    }
 
-    if(CheckCollisionLines(a_corners.a, a_corners.b, b_corners.b, b_corners.c, NULL)) return true;
-    if(CheckCollisionLines(a_corners.b, a_corners.c, b_corners.b, b_corners.c, NULL)) return true;
-    if(CheckCollisionLines(a_corners.c, a_corners.d, b_corners.b, b_corners.c, NULL)) return true;
-    if(CheckCollisionLines(a_corners.d, a_corners.a, b_corners.b, b_corners.c, NULL)) return true;
+    return hits;
+}
 
-    if(CheckCollisionLines(a_corners.a, a_corners.b, b_corners.c, b_corners.d, NULL)) return true;
-    if(CheckCollisionLines(a_corners.b, a_corners.c, b_corners.c, b_corners.d, NULL)) return true;
-    if(CheckCollisionLines(a_corners.c, a_corners.d, b_corners.c, b_corners.d, NULL)) return true;
-    if(CheckCollisionLines(a_corners.d, a_corners.a, b_corners.c, b_corners.d, NULL)) return true;
+/**
+ * Check whether two Wectangles are colliding. Far-apart pairs are rejected by their bounding circles; the rest are baked (one `sinf()`/`cosf()` per Wectangle, none if it's axis-aligned) and get `CheckCollisionWecsBaked()`'s separating-axis test. Like Raylib's `CheckCollisionRecs()`, Wectangles that only touch along an edge don't collide.
+ * 
+ * @param a, b The Wectangles in question.
+ * @return Whether or not they collide.
+ */
+bool CheckCollisionWecs(Wectangle a, Wectangle b) {
+    Vector2 between = Vector2Subtract(WectangleAxis(b), WectangleAxis(a));
 
-    if(CheckCollisionLines(a_corners.a, a_corners.b, b_corners.d, b_corners.a, NULL)) return true;
-    if(CheckCollisionLines(a_corners.b, a_corners.c, b_corners.d, b_corners.a, NULL)) return true;
-    if(CheckCollisionLines(a_corners.c, a_corners.d, b_corners.d, b_corners.a, NULL)) return true;
-    if(CheckCollisionLines(a_corners.d, a_corners.a, b_corners.d, b_corners.a, NULL)) return true;
+    float reach = WectangleChord(a) + WectangleChord(b);
+    if(Vector2DotProduct(between, between) > reach * reach) return false;
 
-    return false;
+    return CheckCollisionWecsBaked(BakeWectangle(a), BakeWectangle(b));
 }
 
 /**
@@ -504,137 +653,646 @@ inline bool CheckCollisionWecRec(Wectangle a, Rectangle b) {
     return CheckCollisionWecs(a, WectangleFromRec(b));
 }
 
+// clip the polygon `in` to the side of the line through `p` and `q` where `side * cross(q - p, point - p) >= 0`, into `out`; returns the number of points kept (at most one more than `count`)
+unsigned int WecClipPolygon(const Vector2 * in, unsigned int count, Vector2 p, Vector2 q, float side, Vector2 * out) {
+    Vector2 edge = Vector2Subtract(q, p);
+    unsigned int out_count = 0;
+
+    for(unsigned int i = 0; i < count; i++) {
+        Vector2 cur = in[i];
+        Vector2 next = in[(i + 1 == count) ? 0 : i + 1];
+        float cur_side = side * (edge.x * (cur.y - p.y) - edge.y * (cur.x - p.x));
+        float next_side = side * (edge.x * (next.y - p.y) - edge.y * (next.x - p.x));
+
+        if(cur_side >= 0.0f) out[out_count++] = cur;
+        if((cur_side > 0.0f && next_side < 0.0f) || (cur_side < 0.0f && next_side > 0.0f)) {
+            out[out_count++] = Vector2Lerp(cur, next, cur_side / (cur_side - next_side));
+        }
+    }
+
+    return out_count;
+}
+
 /**
- * qsort-compatible function for comparing the counterclockwiseness of two points relative to a given center point.
+ * Get the collision points of two Wectangles. **Not reentrant**; the points are in a static buffer that the next call overwrites. See `GetCollisionWecsInto()`.
  * 
- * @param vector2_a, vector2_b The points in question. Passed as `(void *) ((const Vector2 *) v)` by `qsort()`.
- * @param centroid The center-point in question. Passed as `(void *) ((const Vector2 *) v)` by `qsort()`.
- * @return qsort-format, checking counterclockwiseness.
+ * @param a, b The Wectangles in question.
+ * @return See `WecCollision`.
  */
-int qs_counterclockwise(void * centroid, const void * vector2_a, const void * vector2_b) {
-    Vector2 a = *((const Vector2 *) vector2_a);
-    Vector2 b = *((const Vector2 *) vector2_b);
-    Vector2 c = *((const Vector2 *) centroid);
+WecCollision GetCollisionWecs(Wectangle a, Wectangle b) {
+    return GetCollisionWecsBaked(BakeWectangle(a), BakeWectangle(b));
+}
 
-    float ax = a.x - c.x;
-    float ay = a.y - c.y;
-    float bx = b.x - c.x;
-    float by = b.y - c.y;
-    
-    float angle_a = PI + atan2f(ay, ax);
-    float angle_b = PI + atan2f(by, bx);
+/**
+ * Get the collision points between a Wectangle and a Rectangle. **Not reentrant**, see `GetCollisionWecs()`.
+ * 
+ * @param a The Wectangle in question.
+ * @param b The Rectangle in question.
+ * @return `GetCollisionWecs(a, WectangleFromRec(b));`
+ */
+inline WecCollision GetCollisionWecRec(Wectangle a, Rectangle b) {
+    return GetCollisionWecs(a, WectangleFromRec(b));
+}
+
+/**
+ * Get the collision points of two Wectangles into a buffer of your own. No allocation and no static state, so this is safe to call from several threads at once. See `GetCollisionWecsBakedInto()`.
+ * 
+ * @param a, b The Wectangles in question.
+ * @param out Where to put the points; room for 8.
+ * @return See `WecCollision`; `points` is `out` (or `NULL`).
+ */
+WecCollision GetCollisionWecsInto(Wectangle a, Wectangle b, Vector2 out[8]) {
+    return GetCollisionWecsBakedInto(BakeWectangle(a), BakeWectangle(b), out);
+}
 
-    if(angle_a < angle_b) return -1;
-    if(angle_a > angle_b) return 1;
+/**
+ * Get the collision points between a Wectangle and a Rectangle into a buffer of your own. See `GetCollisionWecsInto()`.
+ * 
+ * @param a The Wectangle in question.
+ * @param b The Rectangle in question.
+ * @param out Where to put the points; room for 8.
+ * @return See `WecCollision`; `points` is `out` (or `NULL`).
+ */
+WecCollision GetCollisionWecRecInto(Wectangle a, Rectangle b, Vector2 out[8]) {
+    return GetCollisionWecsBakedInto(BakeWectangle(a), BakeWectangle(WectangleFromRec(b)), out);
+}
 
-    float distance_a = Vector2Distance(*((const Vector2 *) vector2_a), *((const Vector2 *) centroid));
-    float distance_b = Vector2Distance(*((const Vector2 *) vector2_b), *((const Vector2 *) centroid));
-    if(distance_a > distance_b) return -1;
-    if(distance_a < distance_b) return 1;
+/**
+ * Get the area of a collision, i.e. of the region where two Wectangles overlap (shoelace formula).
+ * 
+ * @param coll The collision in question. See `WecCollision`.
+ * @return The area; `0.0f` for fewer than three points.
+ */
+float WecCollisionArea(WecCollision coll) {
+    if(coll.num_points < 3) return 0.0f;
 
-    return 0;
+    float output = 0.0f;
+    for(unsigned int i = 0; i < coll.num_points; i++) {
+        Vector2 cur = coll.points[i];
+        Vector2 next = coll.points[(i + 1 == coll.num_points) ? 0 : i + 1];
+        output += (cur.x * next.y) - (next.x * cur.y);
+    }
+    return fabsf(output) * 0.5f;
 }
 
 /**
- * Get the collision points of two Wectangles.
+ * Get the contact manifold of two Wectangles: the separating normal, penetration depth, contact points and overlap area, in one pass. See `WecManifold`. Reentrant.
  * 
  * @param a, b The Wectangles in question.
- * @return See `WecCollision`.
+ * @return See `WecManifold`.
  */
-WecCollision GetCollisionWecs(Wectangle a, Wectangle b) {
-    a = (Wectangle) { a.x, a.y, a.width, a.height, (fmodf(a.rot, 90.0f) == 0.0f) ? a.rot + 0.02f : a.rot };
-    b = (Wectangle) { b.x, b.y, b.width, b.height, (fmodf(b.rot, 90.0f) == 0.0f) ? b.rot + 0.02f : b.rot };
-    WecCorners a_corners = WectangleCorners(a);
-    WecCorners b_corners = WectangleCorners(b);
+WecManifold GetManifoldWecs(Wectangle a, Wectangle b) {
+    return GetManifoldWecsBaked(BakeWectangle(a), BakeWectangle(b));
+}
 
-    static Vector2 corners[8] = { 0 };
-    unsigned int corners_idx = 0;
+/**
+ * Get the contact manifold of a Wectangle and a Rectangle. See `GetManifoldWecs()`.
+ * 
+ * @param a The Wectangle in question.
+ * @param b The Rectangle in question.
+ * @return See `WecManifold`.
+ */
+WecManifold GetManifoldWecRec(Wectangle a, Rectangle b) {
+    return GetManifoldWecsBaked(BakeWectangle(a), BakeWectangle(WectangleFromRec(b)));
+}
 
-    if(!CheckCollisionWecs(a, b)) return (WecCollision) { 0 };
+//----------------------------
+// BAKED WECTANGLES
+
+// fill in everything but the sine and cosine from `baked->wec`
+void WecBakedPlace(WecBaked * baked) {
+    baked->center = WectangleAxis(baked->wec);
+    baked->half = (Vector2) { fabsf(baked->wec.width) * 0.5f, fabsf(baked->wec.height) * 0.5f };
+    baked->corners = WecCornersOf(baked->center, baked->wec.width, baked->wec.height, baked->sin_rot, baked->cos_rot);
+    baked->bounds = WecBoundsOf(baked->center, baked->half, baked->sin_rot, baked->cos_rot);
+}
 
-    #define POINTC(field, wec) if(CheckCollisionPointWec(a_corners.field, wec)) { corners[corners_idx] = a_corners.field; corners_idx++; }
+/**
+ * Bake a Wectangle, i.e. work out everything the `...Baked()` functions need. Costs one `sinf()`/`cosf()` (none if it's axis-aligned), about as much as one `CheckCollisionWecs()`.
+ * 
+ * @param wec The Wectangle in question.
+ * @return See `WecBaked`.
+ */
+WecBaked BakeWectangle(Wectangle wec) {
+    WecBaked baked = { .wec = wec };
+    WectangleSinCos(wec, &baked.sin_rot, &baked.cos_rot);
+    WecBakedPlace(&baked);
+    return baked;
+}
 
-    POINTC(a, b);
-    POINTC(b, b);
-    POINTC(c, b);
-    POINTC(d, b);
+/**
+ * Update a baked Wectangle after the Wectangle changed. If its rotation didn't change, this skips the `sinf()`/`cosf()`.
+ * 
+ * @param baked The baked Wectangle to update.
+ * @param wec The Wectangle's new value.
+ */
+void RebakeWectangle(WecBaked * baked, Wectangle wec) {
+    if(wec.rot != baked->wec.rot) {
+        *baked = BakeWectangle(wec);
+        return;
+    }
 
-    #undef POINTC
-    #define POINTC(field, wec) if(CheckCollisionPointWec(b_corners.field, wec)) { corners[corners_idx] = b_corners.field; corners_idx++; }
+    baked->wec = wec;
+    WecBakedPlace(baked);
+}
 
-    POINTC(a, a);
-    POINTC(b, a);
-    POINTC(c, a);
-    POINTC(d, a);
+/**
+ * Translate a baked Wectangle. Just additions; see `TranslateWectangle()`.
+ * 
+ * @param baked The baked Wectangle in question.
+ * @param trans The amount to translate it.
+ * @return The baked Wectangle, moved by `trans`.
+ */
+WecBaked TranslateWecBaked(WecBaked baked, Vector2 trans) {
+    baked.wec = TranslateWectangle(baked.wec, trans);
+    baked.center = Vector2Add(baked.center, trans);
+    baked.corners = (WecCorners) { Vector2Add(baked.corners.a, trans), Vector2Add(baked.corners.b, trans), Vector2Add(baked.corners.c, trans), Vector2Add(baked.corners.d, trans) };
+    baked.bounds.x += trans.x;
+    baked.bounds.y += trans.y;
+    return baked;
+}
 
-    #undef POINTC
+/**
+ * Get the two triangles that make up a baked Wectangle. See `WectangleTris()`.
+ */
+WectTris WectangleTrisBaked(WecBaked baked) {
+    return WecCornersTris(baked.corners);
+}
 
-    Vector2 coll = Vector2Zero();
-    #define EDGEC(x, y, z, w) if(CheckCollisionLines(a_corners.x, a_corners.y, b_corners.z, b_corners.w, &coll)) { corners[corners_idx] = coll; corners_idx++; }
-    
-    EDGEC(a, b, a, b);
-    EDGEC(b, c, a, b);
-    EDGEC(c, d, a, b);
-    EDGEC(d, a, a, b);
-    EDGEC(a, b, b, c);
-    EDGEC(b, c, b, c);
-    EDGEC(c, d, b, c);
-    EDGEC(d, a, b, c);
-    EDGEC(a, b, c, d);
-    EDGEC(b, c, c, d);
-    EDGEC(c, d, c, d);
-    EDGEC(d, a, c, d);
-    EDGEC(a, b, d, a);
-    EDGEC(b, c, d, a);
-    EDGEC(c, d, d, a);
-    EDGEC(d, a, d, a);
-
-    #undef EDGEC
-
-    if(corners_idx == 0) return (WecCollision) { 0 };
-
-    Vector2 centroid = Vector2Zero();
-
-    for(unsigned int i = 0; i < corners_idx; i++) {
-        centroid = Vector2Add(centroid, corners[i]);
+/**
+ * Draw a baked Wectangle to the screen. See `DrawWectangle()`.
+ */
+void DrawWectangleBaked(WecBaked baked, Color color) {
+    if(baked.sin_rot == 0.0f || baked.cos_rot == 0.0f) {
+        DrawRectangleRec(baked.bounds, color);
+        return;
     }
-    centroid = Vector2Scale(centroid, 1.0f / (float) corners_idx);
 
-    qsort_s(corners, corners_idx, sizeof(Vector2), &qs_counterclockwise, &centroid);
+    WectTris tris = WecCornersTris(baked.corners);
+    DrawTriangle(tris.a1, tris.a2, tris.a3, color);
+    DrawTriangle(tris.b1, tris.b2, tris.b3, color);
+}
+
+/**
+ * Draw a baked Wectangle's outline to the screen. See `DrawWectangleLines()`.
+ */
+void DrawWectangleLinesBaked(WecBaked baked, Color color) {
+    if(baked.sin_rot == 0.0f || baked.cos_rot == 0.0f) {
+        // same on-center adjustment as DrawWectangleLinesEx()
+        DrawRectangleLinesEx((Rectangle) { baked.bounds.x - 0.5f, baked.bounds.y - 0.5f, baked.bounds.width + 1.0f, baked.bounds.height + 1.0f }, 1.0f, color);
+        return;
+    }
 
-    static WecCollision output = { corners, 0 };
-    output.num_points = corners_idx;
+    DrawLineV(baked.corners.a, baked.corners.b, color);
+    DrawLineV(baked.corners.b, baked.corners.c, color);
+    DrawLineV(baked.corners.c, baked.corners.d, color);
+    DrawLineV(baked.corners.d, baked.corners.a, color);
+}
 
-    return output;
+/**
+ * Draw a texture within a baked Wectangle. See `DrawWectangleTex()`. `DrawTexturePro()` rotates about its `origin`, so this just puts the origin at the center; no corners needed.
+ */
+void DrawWectangleTexBaked(WecBaked baked, Texture2D tex, Color tint) {
+    Rectangle dest = { baked.center.x, baked.center.y, baked.wec.width, baked.wec.height };
+    Vector2 origin = { baked.wec.width * 0.5f, baked.wec.height * 0.5f };
+    DrawTexturePro(tex, (Rectangle) { 0, 0, tex.width, tex.height }, dest, origin, baked.wec.rot, tint);
 }
 
 /**
- * Get the collision points between a Wectangle and a Rectangle.
+ * Check whether a point is inside a baked Wectangle; no trig. See `CheckCollisionPointWec()`.
  * 
- * @param a The Wectangle in question.
+ * @param point The point in question.
+ * @param baked The baked Wectangle in question.
+ * @return Whether or not `point` is inside `baked`.
+ */
+bool CheckCollisionPointWecBaked(Vector2 point, WecBaked baked) {
+    Vector2 local = WecLocalPoint(point, baked.center, baked.sin_rot, baked.cos_rot);
+    return (fabsf(local.x) < baked.half.x) && (fabsf(local.y) < baked.half.y);
+}
+
+/**
+ * Check whether a Circle and a baked Wectangle collide; no trig. See `GetCollisionCircleWec()`.
+ * 
+ * @param c The center of the Circle in question.
+ * @param radius The radius of the Circle in question.
+ * @param baked The baked Wectangle in question.
+ * @return Whether or not they collide.
+ */
+bool CheckCollisionCircleWecBaked(Vector2 c, float radius, WecBaked baked) {
+    return WecCircleClosest(c, radius, baked.center, baked.half, baked.sin_rot, baked.cos_rot, NULL);
+}
+
+// how far two Wectangles overlap along `axis`, given their edge directions (`axes`, as below), half-extents and the vector between their centers; zero or less means they don't
+float WecOverlapAlong(const Vector2 axes[4], Vector2 a_half, Vector2 b_half, Vector2 between, Vector2 axis) {
+    float a_shadow = a_half.x * fabsf(Vector2DotProduct(axes[0], axis)) + a_half.y * fabsf(Vector2DotProduct(axes[1], axis));
+    float b_shadow = b_half.x * fabsf(Vector2DotProduct(axes[2], axis)) + b_half.y * fabsf(Vector2DotProduct(axes[3], axis));
+    return a_shadow + b_shadow - fabsf(Vector2DotProduct(between, axis));
+}
+
+/**
+ * Check whether two baked Wectangles are colliding. Pairs whose bounding boxes don't overlap are rejected straight away; the rest get a separating-axis test. No trig. See `CheckCollisionWecs()`.
+ * 
+ * @param a, b The baked Wectangles in question.
+ * @return Whether or not they collide.
+ */
+bool CheckCollisionWecsBaked(WecBaked a, WecBaked b) {
+    if(!CheckCollisionRecs(a.bounds, b.bounds)) return false;
+
+    Vector2 between = Vector2Subtract(b.center, a.center);
+
+    // the edge directions of a, then b; two convex shapes are apart iff their shadows on one of their edge normals are
+    Vector2 axes[4] = { { a.cos_rot, a.sin_rot }, { -a.sin_rot, a.cos_rot }, { b.cos_rot, b.sin_rot }, { -b.sin_rot, b.cos_rot } };
+
+    for(int i = 0; i < 4; i++) {
+        if(WecOverlapAlong(axes, a.half, b.half, between, axes[i]) <= 0.0f) return false;
+    }
+
+    return true;
+}
+
+/**
+ * Check whether or not a baked Wectangle and a Rectangle are colliding. Baking the Rectangle is free (no rotation).
+ * 
+ * @param a The baked Wectangle in question.
  * @param b The Rectangle in question.
- * @return `GetCollisionWecs(a, WectangleFromRec(b));`
+ * @return `CheckCollisionWecsBaked(a, BakeWectangle(WectangleFromRec(b)));`
  */
-inline WecCollision GetCollisionWecRec(Wectangle a, Rectangle b) {
-    return GetCollisionWecs(a, WectangleFromRec(b));
+bool CheckCollisionWecRecBaked(WecBaked a, Rectangle b) {
+    return CheckCollisionWecsBaked(a, BakeWectangle(WectangleFromRec(b)));
 }
 
-//! **DOES NOT WORK**
-float WecCollisionArea(WecCollision coll) {
-    if(coll.num_points < 3) return 0.0f;
+/**
+ * Get the collision points of two baked Wectangles. **Not reentrant**, see `GetCollisionWecs()`.
+ * 
+ * @param a, b The baked Wectangles in question.
+ * @return See `WecCollision`.
+ */
+WecCollision GetCollisionWecsBaked(WecBaked a, WecBaked b) {
+    static Vector2 points[8] = { 0 };
+    return GetCollisionWecsBakedInto(a, b, points);
+}
 
-    float xs[coll.num_points + 1];
-    for(unsigned int i = 0; i < coll.num_points; i++) xs[i] = coll.points[i].x;
-    xs[coll.num_points] = coll.points[0].x;
+// the clipping half of GetCollisionWecsBakedInto(), for Wectangles already known to collide; returns the number of points
+unsigned int WecClipOverlap(const WecBaked * a, const WecBaked * b, Vector2 out[8]) {
+    Vector2 clip[4] = { b->corners.a, b->corners.b, b->corners.c, b->corners.d };
+    // corners go clockwise (on screen) unless exactly one of width and height is negative
+    float side = (b->wec.width * b->wec.height < 0.0f) ? -1.0f : 1.0f;
+
+    // ping-pong between `out` and `scratch`; after four clips the result is back in `out`
+    Vector2 scratch[8];
+    Vector2 * from = out;
+    Vector2 * to = scratch;
+    from[0] = a->corners.a;
+    from[1] = a->corners.b;
+    from[2] = a->corners.c;
+    from[3] = a->corners.d;
+
+    unsigned int count = 4;
+    for(int i = 0; i < 4; i++) {
+        count = WecClipPolygon(from, count, clip[i], clip[(i + 1) % 4], side, to);
+        if(count == 0) return 0;
 
-    float ys[coll.num_points + 1];
-    for(unsigned int i = 0; i < coll.num_points; i++) ys[i] = coll.points[i].y;
-    ys[coll.num_points] = coll.points[0].y;
+        Vector2 * swap = from;
+        from = to;
+        to = swap;
+    }
 
-    float output = 0.0f;
-    for(unsigned int i = 0; i < coll.num_points; i++) output += (xs[i] * ys[i + 1]);
-    for(unsigned int i = 0; i < coll.num_points; i++) output -= (xs[i + 1] * ys[i]);
-    return output * 0.5f;
+    // corners of a that sit on an edge of b come out twice
+    unsigned int kept = 0;
+    for(unsigned int i = 0; i < count; i++) {
+        if(kept > 0 && Vector2Equals(out[kept - 1], out[i])) continue;
+        out[kept++] = out[i];
+    }
+    while(kept > 1 && Vector2Equals(out[kept - 1], out[0])) kept--;
+
+    // a's winding carried through; flip to counter-clockwise if it was clockwise
+    if(a->wec.width * a->wec.height > 0.0f) {
+        for(unsigned int i = 0; i < kept / 2; i++) {
+            Vector2 swap = out[i];
+            out[i] = out[kept - 1 - i];
+            out[kept - 1 - i] = swap;
+        }
+    }
+
+    return kept;
+}
+
+/**
+ * Get the collision points of two baked Wectangles into a buffer of your own. `a` is clipped against each of `b`'s edges in turn (Sutherland-Hodgman), which leaves the overlap's corners already in order; no sorting, and no trig. Safe to call from several threads at once.
+ * 
+ * @param a, b The baked Wectangles in question.
+ * @param out Where to put the points; room for 8 (a rectangle clipped by four lines has at most eight corners).
+ * @return See `WecCollision`; `points` is `out` (or `NULL`).
+ */
+WecCollision GetCollisionWecsBakedInto(WecBaked a, WecBaked b, Vector2 out[8]) {
+    if(!CheckCollisionWecsBaked(a, b)) return (WecCollision) { 0 };
+
+    unsigned int count = WecClipOverlap(&a, &b, out);
+    return (WecCollision) { (count == 0) ? NULL : out, count };
+}
+
+/**
+ * Get the contact manifold of two baked Wectangles. The separating-axis test that decides whether they collide also finds the normal and depth; the overlap is then clipped out as in `GetCollisionWecsBakedInto()`. Reentrant.
+ * 
+ * @param a, b The baked Wectangles in question.
+ * @return See `WecManifold`.
+ */
+WecManifold GetManifoldWecsBaked(WecBaked a, WecBaked b) {
+    WecManifold manifold = { 0 };
+    if(!CheckCollisionRecs(a.bounds, b.bounds)) return manifold;
+
+    Vector2 between = Vector2Subtract(b.center, a.center);
+    Vector2 axes[4] = { { a.cos_rot, a.sin_rot }, { -a.sin_rot, a.cos_rot }, { b.cos_rot, b.sin_rot }, { -b.sin_rot, b.cos_rot } };
+
+    float depth = 0.0f;
+    Vector2 normal = axes[0];
+    for(int i = 0; i < 4; i++) {
+        float overlap = WecOverlapAlong(axes, a.half, b.half, between, axes[i]);
+        if(overlap <= 0.0f) return manifold;
+
+        if(i == 0 || overlap < depth) {
+            depth = overlap;
+            normal = axes[i];
+        }
+    }
+
+    manifold.normal = (Vector2DotProduct(normal, between) < 0.0f) ? Vector2Negate(normal) : normal;
+    manifold.depth = depth;
+    manifold.num_points = WecClipOverlap(&a, &b, manifold.points);
+
+    // area and centroid together; the centroid of a polygon weights each edge's triangle (with the origin) by its area
+    float twice_area = 0.0f;
+    Vector2 weighted = Vector2Zero();
+    for(unsigned int i = 0; i < manifold.num_points; i++) {
+        Vector2 cur = manifold.points[i];
+        Vector2 next = manifold.points[(i + 1 == manifold.num_points) ? 0 : i + 1];
+        float cross = (cur.x * next.y) - (next.x * cur.y);
+        twice_area += cross;
+        weighted = Vector2Add(weighted, Vector2Scale(Vector2Add(cur, next), cross));
+    }
+
+    manifold.area = fabsf(twice_area) * 0.5f;
+    if(manifold.area > 0.000001f) {
+        manifold.centroid = Vector2Scale(weighted, 1.0f / (3.0f * twice_area));
+    } else if(manifold.num_points > 0) {
+        // a sliver; any average of its corners will do
+        for(unsigned int i = 0; i < manifold.num_points; i++) manifold.centroid = Vector2Add(manifold.centroid, manifold.points[i]);
+        manifold.centroid = Vector2Scale(manifold.centroid, 1.0f / (float) manifold.num_points);
+    }
+
+    return manifold;
+}
+
+//----------------------------
+// SWEPT COLLISION
+
+#ifndef WEC_SWEEP_TOLERANCE
+// how close (in the same units as the Wectangles, i.e. pixels) SweepWectangleEx() gets two Wectangles before calling it a hit
+#define WEC_SWEEP_TOLERANCE 0.01f
+#endif
+
+#ifndef WEC_SWEEP_MAX_STEPS
+// how many steps SweepWectangleEx() takes before giving up and calling it a hit where it stopped
+#define WEC_SWEEP_MAX_STEPS 64
+#endif
+
+// how far apart two Wectangles are along the edge normal they're furthest apart on (zero or less if they overlap, the least overlap then), and that normal, from `a` towards `b`. Never more than the actual distance between them
+float WecSeparation(const WecBaked * a, const WecBaked * b, Vector2 * normal) {
+    Vector2 between = Vector2Subtract(b->center, a->center);
+    Vector2 axes[4] = { { a->cos_rot, a->sin_rot }, { -a->sin_rot, a->cos_rot }, { b->cos_rot, b->sin_rot }, { -b->sin_rot, b->cos_rot } };
+
+    float gap = 0.0f;
+    for(int i = 0; i < 4; i++) {
+        float axis_gap = -WecOverlapAlong(axes, a->half, b->half, between, axes[i]);
+        if(i == 0 || axis_gap > gap) {
+            gap = axis_gap;
+            *normal = axes[i];
+        }
+    }
+
+    if(Vector2DotProduct(*normal, between) < 0.0f) *normal = Vector2Negate(*normal);
+    return gap;
+}
+
+/**
+ * Sweep a moving Wectangle against a still one: find when (if at all) `a` first touches `b` while moving by `velocity`, instead of only checking where it ends up. Fast Wectangles can't tunnel through thin ones this way, whatever the timestep. For two moving Wectangles, pass the difference of their velocities. Touching without overlapping, e.g. sliding along an edge, isn't a hit, like `CheckCollisionWecs()`.
+ * 
+ * @param a The moving Wectangle, where it starts.
+ * @param velocity How far `a` moves.
+ * @param b The Wectangle in the way.
+ * @return See `WecSweep`.
+ */
+WecSweep SweepWectangle(Wectangle a, Vector2 velocity, Wectangle b) {
+    return SweepWecsBaked(BakeWectangle(a), velocity, BakeWectangle(b));
+}
+
+/**
+ * Sweep a moving Wectangle against a Rectangle. See `SweepWectangle()`.
+ * 
+ * @param a The moving Wectangle, where it starts.
+ * @param velocity How far `a` moves.
+ * @param b The Rectangle in the way.
+ * @return See `WecSweep`.
+ */
+WecSweep SweepWectangleRec(Wectangle a, Vector2 velocity, Rectangle b) {
+    return SweepWecsBaked(BakeWectangle(a), velocity, BakeWectangle(WectangleFromRec(b)));
+}
+
+/**
+ * Sweep a moving baked Wectangle against a still one. Exact: along each of the four edge normals, the shadows overlap for one stretch of the move, and the Wectangles collide where all four stretches do. No trig. See `SweepWectangle()`.
+ * 
+ * @param a The moving baked Wectangle, where it starts.
+ * @param velocity How far `a` moves.
+ * @param b The baked Wectangle in the way.
+ * @return See `WecSweep`.
+ */
+WecSweep SweepWecsBaked(WecBaked a, Vector2 velocity, WecBaked b) {
+    WecSweep sweep = { 0 };
+
+    Rectangle swept = {
+        a.bounds.x + fminf(velocity.x, 0.0f), a.bounds.y + fminf(velocity.y, 0.0f),
+        a.bounds.width + fabsf(velocity.x), a.bounds.height + fabsf(velocity.y)
+    };
+    if(!CheckCollisionRecs(swept, b.bounds)) return sweep;
+
+    Vector2 between = Vector2Subtract(b.center, a.center);
+    Vector2 axes[4] = { { a.cos_rot, a.sin_rot }, { -a.sin_rot, a.cos_rot }, { b.cos_rot, b.sin_rot }, { -b.sin_rot, b.cos_rot } };
+
+    // the stretch of the move [enter, exit] during which every pair of shadows overlaps
+    float enter = -INFINITY;
+    float exit = INFINITY;
+    int enter_axis = -1;
+
+    for(int i = 0; i < 4; i++) {
+        float shadow = WecOverlapAlong(axes, a.half, b.half, Vector2Zero(), axes[i]);
+        float distance = Vector2DotProduct(between, axes[i]);
+        float speed = Vector2DotProduct(velocity, axes[i]);
+
+        if(speed == 0.0f) {
+            if(fabsf(distance) >= shadow) return sweep;
+            continue;
+        }
+
+        float t0 = (distance - shadow) / speed;
+        float t1 = (distance + shadow) / speed;
+        if(t0 > t1) {
+            float swap = t0;
+            t0 = t1;
+            t1 = swap;
+        }
+
+        if(t0 > enter) {
+            enter = t0;
+            enter_axis = i;
+        }
+        if(t1 < exit) exit = t1;
+        if(enter >= exit) return sweep;
+    }
+
+    if(exit <= 0.0f || enter > 1.0f) return sweep;
+
+    sweep.hit = true;
+    if(enter <= 0.0f) {
+        // already overlapping; push apart along the least overlap, like GetManifoldWecsBaked()
+        WecSeparation(&a, &b, &sweep.normal);
+        return sweep;
+    }
+
+    sweep.time = enter;
+    Vector2 axis = axes[enter_axis];
+    sweep.normal = (Vector2DotProduct(axis, Vector2Subtract(between, Vector2Scale(velocity, enter))) < 0.0f) ? Vector2Negate(axis) : axis;
+    return sweep;
+}
+
+/**
+ * Sweep a moving, spinning Wectangle against a still one. Conservative advancement: `a` is moved forward by as much as it can go without possibly reaching `b`, over and over, until it's within `WEC_SWEEP_TOLERANCE` of `b` or the move is over. So a hit's `time` may be a touch early, never late. Without `spin`, this is just `SweepWectangle()`.
+ * 
+ * @param a The moving Wectangle, where (and how rotated) it starts.
+ * @param velocity How far `a` moves.
+ * @param spin How far `a` rotates about its center, **in degrees**, over the move.
+ * @param b The Wectangle in the way.
+ * @return See `WecSweep`.
+ */
+WecSweep SweepWectangleEx(Wectangle a, Vector2 velocity, float spin, Wectangle b) {
+    if(spin == 0.0f) return SweepWectangle(a, velocity, b);
+
+    WecSweep sweep = { 0 };
+    WecBaked still = BakeWectangle(b);
+
+    // a stays within `radius` of its center, however it's rotated
+    float radius = WectangleChord(a);
+    Vector2 start = WectangleAxis(a);
+    Rectangle swept = {
+        start.x + fminf(velocity.x, 0.0f) - radius, start.y + fminf(velocity.y, 0.0f) - radius,
+        fabsf(velocity.x) + 2.0f * radius, fabsf(velocity.y) + 2.0f * radius
+    };
+    if(!CheckCollisionRecs(swept, still.bounds)) return sweep;
+
+    // no point of a moves faster than this
+    float max_speed = Vector2Length(velocity) + fabsf(spin * DEG2RAD) * radius;
+
+    float time = 0.0f;
+    for(int step = 0; step < WEC_SWEEP_MAX_STEPS; step++) {
+        Wectangle moved = TranslateWectangle(a, Vector2Scale(velocity, time));
+        moved.rot = a.rot + spin * time;
+        WecBaked at = BakeWectangle(moved);
+
+        Vector2 normal;
+        float gap = WecSeparation(&at, &still, &normal);
+        if(gap < WEC_SWEEP_TOLERANCE) return (WecSweep) { true, time, normal };
+
+        // the gap is never more than the distance, so a can't close it any sooner than this
+        time += gap / max_speed;
+        if(time > 1.0f) return sweep;
+    }
+
+    // still closing in; stop here rather than risk passing through
+    Wectangle moved = TranslateWectangle(a, Vector2Scale(velocity, time));
+    moved.rot = a.rot + spin * time;
+    WecBaked at = BakeWectangle(moved);
+    sweep = (WecSweep) { true, time, Vector2Zero() };
+    WecSeparation(&at, &still, &sweep.normal);
+    return sweep;
+}
+
+//----------------------------
+// RAYCASTING
+
+// the slab test, in the frame of a Wectangle given by its center, positive half-extents, sine and cosine; `direction` must be a unit vector
+WecRayHit WecRaySlab(Vector2 origin, Vector2 direction, float max_distance, Vector2 center, Vector2 half, float sin_rot, float cos_rot) {
+    WecRayHit hit = { 0 };
+
+    Vector2 local = WecLocalPoint(origin, center, sin_rot, cos_rot);
+    float from[2] = { local.x, local.y };
+    float toward[2] = { direction.x * cos_rot + direction.y * sin_rot, direction.y * cos_rot - direction.x * sin_rot };
+    float extent[2] = { half.x, half.y };
+
+    // the ray is inside both slabs between `near` and `far`; it came in through side `near_side` of slab `near_axis`
+    float near = -INFINITY;
+    float far = INFINITY;
+    int near_axis = 0;
+    float near_side = 0.0f;
+
+    for(int k = 0; k < 2; k++) {
+        if(toward[k] == 0.0f) {
+            if(fabsf(from[k]) >= extent[k]) return hit;
+            continue;
+        }
+
+        float t0 = (-extent[k] - from[k]) / toward[k];
+        float t1 = (extent[k] - from[k]) / toward[k];
+        float side = -1.0f;
+        if(t0 > t1) {
+            float swap = t0;
+            t0 = t1;
+            t1 = swap;
+            side = 1.0f;
+        }
+
+        if(t0 > near) {
+            near = t0;
+            near_axis = k;
+            near_side = side;
+        }
+        if(t1 < far) far = t1;
+    }
+
+    if(near >= far || near < 0.0f || near > max_distance) return hit;
+
+    Vector2 axis = (near_axis == 0) ? (Vector2) { cos_rot, sin_rot } : (Vector2) { -sin_rot, cos_rot };
+    hit.hit = true;
+    hit.distance = near;
+    hit.point = Vector2Add(origin, Vector2Scale(direction, near));
+    hit.normal = Vector2Scale(axis, near_side);
+    return hit;
+}
+
+/**
+ * Cast a ray at a Wectangle: the slab test, in the Wectangle's frame. Costs one `sinf()`/`cosf()` (none if it's axis-aligned). Rays that start inside a Wectangle, or only graze it, don't hit it. For a segment, pass its direction and length.
+ * 
+ * @param origin Where the ray starts.
+ * @param direction Which way it goes; needn't be a unit vector.
+ * @param max_distance How far it goes; `INFINITY` for no limit.
+ * @param wec The Wectangle in question.
+ * @return See `WecRayHit`.
+ */
+WecRayHit RaycastWectangle(Vector2 origin, Vector2 direction, float max_distance, Wectangle wec) {
+    float length = Vector2Length(direction);
+    if(length == 0.0f) return (WecRayHit) { 0 };
+
+    float sin_rot, cos_rot;
+    WectangleSinCos(wec, &sin_rot, &cos_rot);
+    return WecRaySlab(origin, Vector2Scale(direction, 1.0f / length), max_distance, WectangleAxis(wec), (Vector2) { fabsf(wec.width) * 0.5f, fabsf(wec.height) * 0.5f }, sin_rot, cos_rot);
+}
+
+/**
+ * Cast a ray at a baked Wectangle; no trig. See `RaycastWectangle()`.
+ */
+WecRayHit RaycastWecBaked(Vector2 origin, Vector2 direction, float max_distance, WecBaked baked) {
+    float length = Vector2Length(direction);
+    if(length == 0.0f) return (WecRayHit) { 0 };
+
+    return WecRaySlab(origin, Vector2Scale(direction, 1.0f / length), max_distance, baked.center, baked.half, baked.sin_rot, baked.cos_rot);
 }
 
 //----------------------------